@@ -0,0 +1,138 @@
+/*
+    @file    bench_ack.c
+    @brief   Cross-core SPSC throughput with per-item versus batched index publication
+             (cb_batch on the producer side, cb_ack on the consumer side).
+
+    @date 2026-10-18
+    @version 1.0
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <time.h>
+#include "cb.h"
+#include "cb_batch.h"
+#include "cb_ack.h"
+
+#define RING_ITEMS  4096
+#define TOTAL       (1 << 22)
+#define BATCH       64
+
+static CbItem storage[RING_ITEMS];
+static cb ring;
+static bool batch_producer;
+static bool lazy_consumer;
+static uint64_t out_stores;
+static unsigned checksum;
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void pin(int cpu) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu % CPU_SETSIZE, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+static void *producer(void *arg) {
+    (void)arg;
+    pin(0);
+
+    if (batch_producer) {
+        cb_batch_t b;
+        cb_batch_init(&b, &ring, BATCH / 4, BATCH, 64, 1024);
+        for (uint64_t i = 0, tick = 0; i < TOTAL; tick++) {
+            if (cb_batch_insert(&b, (CbItem)i, tick) == CB_SUCCESS) {
+                i++;
+            } else {
+                sched_yield();
+            }
+        }
+        cb_batch_flush(&b);
+    } else {
+        for (uint64_t i = 0; i < TOTAL;) {
+            if (cb_insert(&ring, (CbItem)i)) {
+                i++;
+            } else {
+                sched_yield();
+            }
+        }
+    }
+    return NULL;
+}
+
+static void *consumer(void *arg) {
+    (void)arg;
+    pin(1);
+
+    unsigned sum = 0;
+    CbItem item;
+    if (lazy_consumer) {
+        cb_ack_t a;
+        cb_ack_init(&a, &ring, BATCH);
+        for (uint64_t n = 0; n < TOTAL;) {
+            if (cb_ack_remove(&a, &item) == CB_SUCCESS) {
+                sum += item;
+                n++;
+            } else {
+                sched_yield();
+            }
+        }
+        cb_ack_release(&a);
+        out_stores = a.releases;
+    } else {
+        for (uint64_t n = 0; n < TOTAL;) {
+            if (cb_remove(&ring, &item)) {
+                sum += item;
+                n++;
+            } else {
+                sched_yield();
+            }
+        }
+        out_stores = TOTAL;
+    }
+    checksum = sum;
+    return NULL;
+}
+
+static void run(const char *name, bool batch, bool lazy) {
+    pthread_t p, c;
+
+    cb_init(&ring, storage, RING_ITEMS);
+    batch_producer = batch;
+    lazy_consumer = lazy;
+
+    double start = now_sec();
+    pthread_create(&c, NULL, consumer, NULL);
+    pthread_create(&p, NULL, producer, NULL);
+    pthread_join(p, NULL);
+    pthread_join(c, NULL);
+    double elapsed = now_sec() - start;
+
+    printf("%-26s %12.1f %14.0f %14llu %12u\n", name, elapsed * 1e3, TOTAL / elapsed,
+           (unsigned long long)out_stores, checksum);
+}
+
+int main() {
+    printf("Cross-core index publication benchmark\n");
+    printf("Items: %d, ring: %d, batch: %d, CPUs online: %ld\n\n", TOTAL, RING_ITEMS, BATCH,
+           (long)sysconf(_SC_NPROCESSORS_ONLN));
+
+    printf("%-26s %12s %14s %14s %12s\n", "mode", "time (ms)", "items/s", "out stores", "checksum");
+    run("per-item (cb_insert/remove)", false, false);
+    run("batched producer", true, false);
+    run("lazy consumer", false, true);
+    run("batched + lazy", true, true);
+    return 0;
+}
@@ -0,0 +1,144 @@
+/*
+    @file    bench_actor.c
+    @brief   Actor runtime message rates: ping-pong between two actors and
+             fan-out from one actor to many, for several worker counts.
+
+    @date 2026-10-18
+    @version 1.0
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdbool.h>
+#include <sched.h>
+#include <unistd.h>
+#include <time.h>
+#include "cb_actor.h"
+
+#define MAILBOX     4096
+#define BATCH       64
+#define PINGPONG    (1 << 19)
+#define FANOUT      16
+#define BROADCASTS  (1 << 16)
+#define WINDOW      1024
+
+static cb_actor_runtime_t rt;
+static cb_actor_run_slot_t run_slots[32];
+static cb_actor_t actors[FANOUT + 1];
+static cb_actor_slot_t mailboxes[FANOUT + 1][MAILBOX];
+static volatile bool done;
+static unsigned dropped;
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static uint64_t processed(const cb_actor_t *actor) {
+    return __atomic_load_n(&actor->processed, __ATOMIC_RELAXED);
+}
+
+/* Bounces the counter back to the sender until it reaches PINGPONG */
+static void ping(cb_actor_t *self, const cb_actor_msg_t *msg, void *ctx) {
+    (void)ctx;
+    if (msg->value >= PINGPONG) {
+        done = true;
+        return;
+    }
+    cb_actor_send(msg->from, self, 0, msg->value + 1);
+}
+
+/* Forwards every message to all receivers */
+static void broadcast(cb_actor_t *self, const cb_actor_msg_t *msg, void *ctx) {
+    (void)ctx;
+    for (int i = 1; i <= FANOUT; i++) {
+        if (cb_actor_send(&actors[i], self, 0, msg->value) != CB_SUCCESS) {
+            dropped++;
+        }
+    }
+}
+
+static void sink(cb_actor_t *self, const cb_actor_msg_t *msg, void *ctx) {
+    (void)self;
+    (void)msg;
+    (void)ctx;
+}
+
+static void run_pingpong(unsigned workers) {
+    cb_actor_runtime_init(&rt, run_slots, 32, BATCH);
+    cb_actor_init(&rt, &actors[0], mailboxes[0], MAILBOX, ping, NULL);
+    cb_actor_init(&rt, &actors[1], mailboxes[1], MAILBOX, ping, NULL);
+    done = false;
+
+    double start = now_sec();
+    cb_actor_start(&rt, workers);
+    cb_actor_send(&actors[0], &actors[1], 0, 0);
+    while (!done) {
+        sched_yield();
+    }
+    double elapsed = now_sec() - start;
+    cb_actor_stop(&rt);
+
+    printf("%-10s %8u %12.1f %14.0f %12llu\n", "ping-pong", workers, elapsed * 1e3, PINGPONG / elapsed,
+           (unsigned long long)(actors[0].turns + actors[1].turns));
+}
+
+static void run_fanout(unsigned workers) {
+    cb_actor_runtime_init(&rt, run_slots, 32, BATCH);
+    cb_actor_init(&rt, &actors[0], mailboxes[0], MAILBOX, broadcast, NULL);
+    for (int i = 1; i <= FANOUT; i++) {
+        cb_actor_init(&rt, &actors[i], mailboxes[i], MAILBOX, sink, NULL);
+    }
+    dropped = 0;
+
+    double start = now_sec();
+    cb_actor_start(&rt, workers);
+    for (uint64_t n = 0; n < BROADCASTS;) {
+        /* Keep the slowest receiver within WINDOW messages so no mailbox overflows */
+        uint64_t slowest = processed(&actors[1]);
+        for (int i = 2; i <= FANOUT; i++) {
+            uint64_t p = processed(&actors[i]);
+            slowest = (p < slowest) ? p : slowest;
+        }
+        if (n - slowest < WINDOW && cb_actor_send(&actors[0], NULL, 0, n) == CB_SUCCESS) {
+            n++;
+        } else {
+            sched_yield();
+        }
+    }
+    for (int i = 1; i <= FANOUT; i++) {
+        while (processed(&actors[i]) < BROADCASTS - dropped / FANOUT) {
+            sched_yield();
+        }
+    }
+    double elapsed = now_sec() - start;
+    cb_actor_stop(&rt);
+
+    uint64_t turns = 0;
+    for (int i = 0; i <= FANOUT; i++) {
+        turns += actors[i].turns;
+    }
+    printf("%-10s %8u %12.1f %14.0f %12llu  (dropped %u)\n", "fan-out", workers, elapsed * 1e3,
+           (double)BROADCASTS * FANOUT / elapsed, (unsigned long long)turns, dropped);
+}
+
+int main() {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    printf("Actor runtime message rate benchmark\n");
+    printf("Ping-pong: %d messages, fan-out: %d x %d, batch: %d, CPUs online: %ld\n\n", PINGPONG,
+           BROADCASTS, FANOUT, BATCH, cpus);
+
+    printf("%-10s %8s %12s %14s %12s\n", "pattern", "workers", "time (ms)", "messages/s", "turns");
+    for (unsigned workers = 1; workers <= 4; workers *= 2) {
+        run_pingpong(workers);
+    }
+    for (unsigned workers = 1; workers <= 4; workers *= 2) {
+        run_fanout(workers);
+    }
+    return 0;
+}
@@ -0,0 +1,123 @@
+/*
+    @file    bench_dgram.c
+    @brief   Per-record sendto/recv versus batched sendmmsg/recvmmsg over a socketpair.
+
+    @date 2026-10-18
+    @version 1.0
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include "cb.h"
+#include "cb_record.h"
+#include "cb_dgram.h"
+
+#define RING_SIZE    (64 * 1024)
+#define RECORD_SIZE  64
+#define BATCH        32
+#define TOTAL        200000
+
+CbItem tx_storage[RING_SIZE];
+CbItem rx_storage[RING_SIZE];
+cb tx;
+cb rx;
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void produce(unsigned count) {
+    uint8_t payload[RECORD_SIZE];
+    memset(payload, 0xA5, sizeof(payload));
+    for (unsigned i = 0; i < count; i++) {
+        cb_record_write(&tx, payload, sizeof(payload));
+    }
+}
+
+/* One sendto and one recv per record, copying through a temporary buffer */
+static double run_single(int sv[2], unsigned long *syscalls) {
+    uint8_t tmp[RECORD_SIZE];
+    size_t length;
+    double start = now_sec();
+
+    for (unsigned done = 0; done < TOTAL; done += BATCH) {
+        produce(BATCH);
+        for (unsigned i = 0; i < BATCH; i++) {
+            cb_record_read(&tx, tmp, sizeof(tmp), &length);
+            send(sv[0], tmp, length, 0);
+            (*syscalls)++;
+        }
+        for (unsigned i = 0; i < BATCH; i++) {
+            ssize_t got = recv(sv[1], tmp, sizeof(tmp), 0);
+            cb_record_write(&rx, tmp, (size_t)got);
+            cb_record_read(&rx, tmp, sizeof(tmp), &length);
+            (*syscalls)++;
+        }
+    }
+
+    return now_sec() - start;
+}
+
+/* One sendmmsg and one recvmmsg per batch, iovecs pointing into the rings */
+static double run_batched(int sv[2], unsigned long *syscalls) {
+    uint8_t tmp[RECORD_SIZE];
+    size_t length;
+    double start = now_sec();
+
+    for (unsigned done = 0; done < TOTAL; done += BATCH) {
+        unsigned n = 0;
+        produce(BATCH);
+        for (unsigned sent = 0; sent < BATCH; sent += n) {
+            cb_dgram_send(&tx, sv[0], BATCH, &n);
+            (*syscalls)++;
+        }
+        for (unsigned got = 0; got < BATCH; got += n) {
+            cb_dgram_recv(&rx, sv[1], BATCH, RECORD_SIZE, &n);
+            (*syscalls)++;
+        }
+        for (unsigned i = 0; i < BATCH; i++) {
+            cb_record_read(&rx, tmp, sizeof(tmp), &length);
+        }
+    }
+
+    return now_sec() - start;
+}
+
+int main() {
+    int sv[2];
+    if (socketpair(AF_UNIX, SOCK_DGRAM, 0, sv) != 0) {
+        perror("socketpair");
+        return 1;
+    }
+
+    cb_init(&tx, tx_storage, RING_SIZE);
+    cb_init(&rx, rx_storage, RING_SIZE);
+
+    printf("Datagram forwarding benchmark\n");
+    printf("Records: %d, record size: %d bytes, batch: %d\n\n", TOTAL, RECORD_SIZE, BATCH);
+
+    unsigned long single_calls = 0;
+    unsigned long batched_calls = 0;
+    double single = run_single(sv, &single_calls);
+    double batched = run_batched(sv, &batched_calls);
+
+    printf("%-22s %12s %14s %12s\n", "mode", "time (ms)", "records/s", "syscalls/rec");
+    printf("%-22s %12.1f %14.0f %12.3f\n", "sendto/recv", single * 1e3,
+           TOTAL / single, (double)single_calls / TOTAL);
+    printf("%-22s %12.1f %14.0f %12.3f\n", "sendmmsg/recvmmsg", batched * 1e3,
+           TOTAL / batched, (double)batched_calls / TOTAL);
+    printf("\nSpeedup: %.2fx\n", single / batched);
+
+    close(sv[0]);
+    close(sv[1]);
+    return 0;
+}
@@ -0,0 +1,129 @@
+/*
+    @file    bench_fir.c
+    @brief   Per-output cb_peek window copy versus cb_fir_process on ring storage.
+
+    @date 2026-10-18
+    @version 1.0
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "cb.h"
+#include "cb_fir.h"
+
+#define TAPS        64
+#define RING_SAMPLES 4096
+#define CHUNK       1024
+#define TOTAL       (1 << 21)
+
+#define ITEMS_PER_SAMPLE (sizeof(float) / sizeof(CbItem))
+
+static CbItem in_storage[RING_SAMPLES * ITEMS_PER_SAMPLE] __attribute__((aligned(32)));
+static CbItem out_storage[RING_SAMPLES * ITEMS_PER_SAMPLE] __attribute__((aligned(32)));
+static cb in;
+static cb out;
+static float taps[TAPS];
+static float input[CHUNK];
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void produce(size_t count) {
+    CbIndex inserted;
+    cb_insert_bulk_ex(&in, (const CbItem *)input, (CbIndex)(count * ITEMS_PER_SAMPLE), &inserted);
+}
+
+static void drain(void) {
+    static float sink[RING_SAMPLES];
+    CbIndex removed;
+    cb_remove_bulk_ex(&out, (CbItem *)sink, cb_dataSize(&out), &removed);
+}
+
+/* Copy the last TAPS samples out with cb_peek for every output sample */
+static double run_peek(float *checksum) {
+    float window[TAPS];
+    double start = now_sec();
+
+    for (size_t done = 0; done < TOTAL; done += CHUNK) {
+        produce(CHUNK);
+        while (cb_dataSize(&in) >= TAPS * ITEMS_PER_SAMPLE) {
+            CbItem *w = (CbItem *)window;
+            for (CbIndex i = 0; i < TAPS * ITEMS_PER_SAMPLE; i++) {
+                cb_peek(&in, i, &w[i]);
+            }
+
+            float acc = 0.0f;
+            for (int k = 0; k < TAPS; k++) {
+                acc += taps[k] * window[TAPS - 1 - k];
+            }
+            *checksum += acc;
+
+            CbIndex inserted;
+            CbItem discard[ITEMS_PER_SAMPLE];
+            cb_insert_bulk_ex(&out, (const CbItem *)&acc, ITEMS_PER_SAMPLE, &inserted);
+            cb_remove_bulk_ex(&in, discard, ITEMS_PER_SAMPLE, &inserted);
+        }
+        drain();
+    }
+
+    return now_sec() - start;
+}
+
+/* Filter in place with the input ring as delay line */
+static double run_fir(float *checksum) {
+    static float sink[RING_SAMPLES];
+    cb_fir_t fir;
+    double start = now_sec();
+
+    cb_fir_init_f32(&fir, taps, TAPS);
+    for (size_t done = 0; done < TOTAL; done += CHUNK) {
+        CbIndex produced;
+        produce(CHUNK);
+        while (cb_fir_process(&fir, &in, &out, RING_SAMPLES, &produced) == CB_SUCCESS) {
+            CbIndex removed;
+            cb_remove_bulk_ex(&out, (CbItem *)sink, produced * ITEMS_PER_SAMPLE, &removed);
+            for (CbIndex i = 0; i < produced; i++) {
+                *checksum += sink[i];
+            }
+        }
+    }
+
+    return now_sec() - start;
+}
+
+int main() {
+    for (int k = 0; k < TAPS; k++) {
+        taps[k] = 1.0f / TAPS;
+    }
+    for (int i = 0; i < CHUNK; i++) {
+        input[i] = (float)sin(i * 0.01);
+    }
+
+    printf("FIR filter benchmark\n");
+    printf("Samples: %d, taps: %d, chunk: %d\n\n", TOTAL, TAPS, CHUNK);
+
+    float sum_peek = 0.0f;
+    float sum_fir = 0.0f;
+
+    cb_init(&in, in_storage, RING_SAMPLES * ITEMS_PER_SAMPLE);
+    cb_init(&out, out_storage, RING_SAMPLES * ITEMS_PER_SAMPLE);
+    double peek = run_peek(&sum_peek);
+
+    cb_init(&in, in_storage, RING_SAMPLES * ITEMS_PER_SAMPLE);
+    cb_init(&out, out_storage, RING_SAMPLES * ITEMS_PER_SAMPLE);
+    double fir = run_fir(&sum_fir);
+
+    printf("%-22s %12s %14s %14s\n", "mode", "time (ms)", "samples/s", "checksum");
+    printf("%-22s %12.1f %14.0f %14.3f\n", "cb_peek window", peek * 1e3, TOTAL / peek, sum_peek);
+    printf("%-22s %12.1f %14.0f %14.3f\n", "cb_fir_process", fir * 1e3, TOTAL / fir, sum_fir);
+    printf("\nSpeedup: %.2fx\n", peek / fir);
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*
+    @file    bench_iter.c
+    @brief   In-place element iteration with and without software prefetch, over element sizes.
+
+    @date 2026-10-18
+    @version 1.0
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "cb.h"
+#include "cb_iter.h"
+
+#define RING_BYTES  (64u << 20)
+#define REPEAT      4
+
+static CbItem *storage;
+static cb ring;
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/* Read one word per cache line of the element, as a header/field parser would */
+static size_t element_bytes;
+static bool handle(void *element, void *ctx) {
+    uint64_t *sum = (uint64_t *)ctx;
+    const uint8_t *p = (const uint8_t *)element;
+    for (size_t off = 0; off < element_bytes; off += 64) {
+        uint64_t word;
+        memcpy(&word, p + off, sizeof(word));
+        *sum += word;
+    }
+    return true;
+}
+
+/* Fill the whole ring; the oldest data is no longer cached when the walk starts */
+static void fill(size_t element_items) {
+    cb_span_t spans[2];
+    CbIndex available;
+    cb_get_write_spans_ex(&ring, spans, &available);
+    CbIndex n = available - available % (CbIndex)element_items;
+    for (CbIndex i = 0; i < n; i++) {
+        CbItem *slot = (i < spans[0].count) ? &spans[0].data[i] : &spans[1].data[i - spans[0].count];
+        *slot = (CbItem)(i * 31u);
+    }
+    cb_commit_write_ex(&ring, n);
+}
+
+static double run(size_t element_items, size_t distance, uint64_t *sum, CbIndex *elements) {
+    double total = 0.0;
+    *elements = 0;
+
+    for (int r = 0; r < REPEAT; r++) {
+        cb_init(&ring, storage, (CbIndex)(RING_BYTES / sizeof(CbItem)));
+        fill(element_items);
+
+        double start = now_sec();
+        CbIndex visited;
+        while (cb_for_each_available(&ring, element_items, distance, handle, sum, (CbIndex)-1, &visited) ==
+               CB_SUCCESS) {
+            *elements += visited;
+        }
+        total += now_sec() - start;
+    }
+    return total;
+}
+
+int main() {
+    static const size_t sizes[] = { 16, 64, 128, 256, 512 };
+    static const size_t distances[] = { CB_ITER_NO_PREFETCH, 256, 1024, 4096 };
+
+    storage = (CbItem *)aligned_alloc(64, RING_BYTES);
+    if (!storage) {
+        return 1;
+    }
+
+    printf("Prefetching iteration benchmark\n");
+    printf("Ring: %u MB, repeats: %d\n\n", RING_BYTES >> 20, REPEAT);
+    printf("%-12s %-12s %14s %14s\n", "element (B)", "prefetch", "ns/element", "checksum");
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t items = sizes[s] / sizeof(CbItem);
+        element_bytes = sizes[s];
+        for (size_t d = 0; d < sizeof(distances) / sizeof(distances[0]); d++) {
+            uint64_t sum = 0;
+            CbIndex elements;
+            double t = run(items, distances[d], &sum, &elements);
+            char label[32];
+            if (distances[d] == CB_ITER_NO_PREFETCH) {
+                snprintf(label, sizeof(label), "off");
+            } else {
+                snprintf(label, sizeof(label), "%zu B", distances[d]);
+            }
+            printf("%-12zu %-12s %14.2f %14llu\n", sizes[s], label, t * 1e9 / (double)elements,
+                   (unsigned long long)sum);
+        }
+    }
+
+    free(storage);
+    return 0;
+}
@@ -0,0 +1,113 @@
+/*
+    @file    bench_mpmc.c
+    @brief   Multi-producer/multi-consumer throughput of cb_mpmc by burst size,
+             one reservation and one publish per burst, and linear versus
+             interleaved slot layout on a near-empty SPSC and an MPMC load.
+
+    @date 2026-10-18
+    @version 1.0
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <time.h>
+#include "cb_mpmc.h"
+
+#define RING_ITEMS  4096
+#define PER_THREAD  (1 << 20)
+#define MAX_THREADS 4
+#define MAX_BURST   64
+
+static CbItem storage[RING_ITEMS];
+static cb_mpmc_t q;
+static uint32_t burst;
+static unsigned producers;
+static unsigned long long consumed;
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void *producer(void *arg) {
+    CbItem items[MAX_BURST] = { 0 };
+    (void)arg;
+
+    for (unsigned sent = 0; sent < PER_THREAD;) {
+        uint32_t n;
+        if (cb_mpmc_enqueue_burst(&q, items, burst, &n) == CB_SUCCESS) {
+            sent += n;
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void *consumer(void *arg) {
+    CbItem items[MAX_BURST];
+    (void)arg;
+
+    while (__atomic_load_n(&consumed, __ATOMIC_RELAXED) < (unsigned long long)producers * PER_THREAD) {
+        uint32_t n;
+        if (cb_mpmc_dequeue_burst(&q, items, burst, &n) == CB_SUCCESS) {
+            __atomic_fetch_add(&consumed, n, __ATOMIC_RELAXED);
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static double run(unsigned nproducers, unsigned nconsumers, uint32_t size, unsigned flags) {
+    pthread_t threads[2 * MAX_THREADS];
+
+    cb_mpmc_init(&q, storage, RING_ITEMS, flags);
+    burst = size;
+    producers = nproducers;
+    consumed = 0;
+
+    double start = now_sec();
+    for (size_t i = 0; i < nproducers; i++) {
+        pthread_create(&threads[i], NULL, producer, NULL);
+    }
+    for (size_t i = 0; i < nconsumers; i++) {
+        pthread_create(&threads[nproducers + i], NULL, consumer, NULL);
+    }
+    for (size_t i = 0; i < nproducers + nconsumers; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    return (double)nproducers * PER_THREAD / (now_sec() - start);
+}
+
+static void run_layout(const char *name, unsigned nproducers, unsigned nconsumers, uint32_t size) {
+    double linear = run(nproducers, nconsumers, size, 0);
+    double interleaved = run(nproducers, nconsumers, size, CB_MPMC_INTERLEAVE);
+    printf("%-22s %14.0f %14.0f\n", name, linear, interleaved);
+}
+
+int main() {
+    printf("Burst MPMC ring benchmark\n");
+    printf("Items per producer: %d, CPUs online: %ld\n\n", PER_THREAD, sysconf(_SC_NPROCESSORS_ONLN));
+
+    printf("2 producers, 2 consumers\n");
+    printf("%10s %14s\n", "burst", "items/s");
+    const uint32_t sizes[] = { 1, 8, 32, 64 };
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        printf("%10u %14.0f\n", sizes[i], run(2, 2, sizes[i], 0));
+    }
+
+    printf("\nSlot layout (items/s)\n");
+    printf("%-22s %14s %14s\n", "workload", "linear", "interleaved");
+    run_layout("SPSC near-empty", 1, 1, 1);
+    run_layout("MPMC 4x4, burst 1", 4, 4, 1);
+    run_layout("MPMC 4x4, burst 8", 4, 4, 8);
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*
+    @file    bench_rpc.c
+    @brief   Round-trip latency of cb_rpc calls between two pinned threads,
+             for several spin-before-park settings and for batched submission.
+
+    @date 2026-10-18
+    @version 1.0
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <time.h>
+#include "cb.h"
+#include "cb_rpc.h"
+
+#define RING_ITEMS  65536
+#define CALLS       10000
+#define BATCH       16
+#define PAYLOAD     32
+
+static CbItem request_storage[RING_ITEMS];
+static CbItem response_storage[RING_ITEMS];
+static cb requests;
+static cb responses;
+static cb_rpc_t ch;
+static volatile bool stop;
+static uint64_t samples[CALLS];
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static void pin(int cpu) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu % CPU_SETSIZE, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+static size_t echo(const void *request, size_t length, void *response, size_t capacity, void *ctx) {
+    (void)ctx;
+    (void)capacity;
+    memcpy(response, request, length);
+    return length;
+}
+
+static void *worker(void *arg) {
+    (void)arg;
+    pin(1);
+
+    unsigned served, idle = 0;
+    while (!stop) {
+        if (cb_rpc_serve(&ch, echo, NULL, BATCH, &served) == CB_SUCCESS) {
+            idle = 0;
+        } else if (++idle > 1000) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static int compare(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void run(const char *name, unsigned spin, unsigned batch) {
+    pthread_t w;
+    char payload[BATCH][PAYLOAD];
+    const void *data[BATCH];
+    size_t lengths[BATCH];
+    char reply[PAYLOAD];
+    size_t length;
+
+    cb_init(&requests, request_storage, RING_ITEMS);
+    cb_init(&responses, response_storage, RING_ITEMS);
+    cb_rpc_init(&ch, &requests, &responses, spin);
+    for (unsigned i = 0; i < BATCH; i++) {
+        memset(payload[i], (int)i, PAYLOAD);
+        data[i] = payload[i];
+        lengths[i] = PAYLOAD;
+    }
+
+    stop = false;
+    pthread_create(&w, NULL, worker, NULL);
+
+    unsigned rounds = CALLS / batch;
+    for (unsigned r = 0; r < rounds; r++) {
+        uint64_t start = now_ns();
+        uint32_t first;
+        unsigned submitted;
+        cb_rpc_submit_batch(&ch, data, lengths, batch, &first, &submitted);
+        for (unsigned i = 0; i < submitted; i++) {
+            cb_rpc_wait(&ch, first + i, reply, sizeof(reply), &length, CB_RPC_FOREVER);
+        }
+        samples[r] = now_ns() - start;
+    }
+
+    stop = true;
+    pthread_join(w, NULL);
+
+    qsort(samples, rounds, sizeof(samples[0]), compare);
+    uint64_t total = 0;
+    for (unsigned r = 0; r < rounds; r++) {
+        total += samples[r];
+    }
+    printf("%-24s %10.0f %10llu %10llu %12.0f %10llu\n", name, (double)total / rounds,
+           (unsigned long long)samples[rounds / 2], (unsigned long long)samples[rounds * 99 / 100],
+           (double)total / (rounds * batch), (unsigned long long)ch.parks);
+}
+
+int main() {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    printf("RPC round-trip latency benchmark\n");
+    printf("Calls: %d, payload: %d bytes, CPUs online: %ld\n\n", CALLS, PAYLOAD, cpus);
+
+    printf("%-24s %10s %10s %10s %12s %10s\n", "mode", "mean (ns)", "p50 (ns)", "p99 (ns)", "ns/request", "parks");
+    run("park at once", 1, 1);
+    run("spin 4096, then park", 4096, 1);
+    if (cpus > 1) {
+        run("spin 1M, then park", 1u << 20, 1);
+    } else {
+        printf("%-24s (skipped: needs two CPUs)\n", "spin 1M, then park");
+    }
+    run("batch of 16, spin 4096", 4096, BATCH);
+    return 0;
+}
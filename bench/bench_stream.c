@@ -0,0 +1,126 @@
+/*
+    @file    bench_stream.c
+    @brief   Cached versus non-temporal bulk inserts, measured by their effect on a
+             cache-sensitive workload interleaved with the recorder.
+
+    @date 2026-10-18
+    @version 1.0
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "cb.h"
+#include "cb_stream.h"
+
+#define RING_BYTES      (256u << 20)
+#define CHUNK_BYTES     (1u << 20)
+#define WORKING_SET     (1u << 20)
+#define CHASE_STEPS     (1u << 16)
+#define ROUNDS          400
+
+static CbItem *storage;
+static CbItem *chunk;
+static size_t *chase;
+static cb ring;
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/* Random cyclic permutation over the working set, one entry per cache line */
+static void build_chase(void) {
+    size_t lines = WORKING_SET / 64;
+    size_t stride = 64 / sizeof(size_t);
+    size_t *order = (size_t *)malloc(lines * sizeof(size_t));
+    uint32_t rng = 12345;
+
+    for (size_t i = 0; i < lines; i++) {
+        order[i] = i;
+    }
+    for (size_t i = lines - 1; i > 0; i--) {
+        rng = rng * 1103515245u + 12345u;
+        size_t j = (rng >> 8) % (i + 1);
+        size_t t = order[i];
+        order[i] = order[j];
+        order[j] = t;
+    }
+    for (size_t i = 0; i < lines; i++) {
+        chase[order[i] * stride] = order[(i + 1) % lines] * stride;
+    }
+    free(order);
+}
+
+/* Dependent loads: each miss costs a full memory round trip */
+static size_t run_chase(size_t pos) {
+    for (unsigned i = 0; i < CHASE_STEPS; i++) {
+        pos = chase[pos];
+    }
+    return pos;
+}
+
+static void run(const char *name, int mode) {
+    CbIndex chunk_items = (CbIndex)(CHUNK_BYTES / sizeof(CbItem));
+    double work = 0.0, record = 0.0;
+    size_t pos = 0;
+
+    cb_init(&ring, storage, (CbIndex)(RING_BYTES / sizeof(CbItem)));
+    run_chase(0);
+
+    for (int r = 0; r < ROUNDS; r++) {
+        if (mode >= 0) {
+            CbIndex inserted;
+            double start = now_sec();
+            if (cb_stream_insert_bulk(&ring, chunk, chunk_items, (cb_stream_mode_t)mode, &inserted) ==
+                CB_ERROR_BUFFER_FULL) {
+                /* The writer thread catches up: release without touching the data */
+                cb_commit_read_ex(&ring, cb_dataSize(&ring));
+                cb_stream_insert_bulk(&ring, chunk, chunk_items, (cb_stream_mode_t)mode, &inserted);
+            }
+            record += now_sec() - start;
+        }
+
+        double start = now_sec();
+        pos = run_chase(pos);
+        work += now_sec() - start;
+    }
+
+    double ns_per_load = work * 1e9 / ((double)ROUNDS * CHASE_STEPS);
+    double gbps = (mode >= 0) ? (double)ROUNDS * CHUNK_BYTES / record / 1e9 : 0.0;
+    printf("%-22s %16.2f %16.2f %10zu\n", name, ns_per_load, gbps, pos);
+}
+
+int main() {
+    storage = (CbItem *)aligned_alloc(64, RING_BYTES);
+    chunk = (CbItem *)aligned_alloc(64, CHUNK_BYTES);
+    chase = (size_t *)aligned_alloc(64, WORKING_SET);
+    if (!storage || !chunk || !chase) {
+        return 1;
+    }
+
+    memset(storage, 0, RING_BYTES);
+    for (size_t i = 0; i < CHUNK_BYTES / sizeof(CbItem); i++) {
+        chunk[i] = (CbItem)i;
+    }
+    build_chase();
+
+    printf("Streaming store benchmark\n");
+    printf("Ring: %u MB, chunk: %u KB, working set: %u KB, streaming supported: %s\n\n",
+           RING_BYTES >> 20, CHUNK_BYTES >> 10, WORKING_SET >> 10, cb_stream_supported() ? "yes" : "no");
+    printf("%-22s %16s %16s %10s\n", "recorder", "workload ns/load", "insert GB/s", "check");
+
+    run("none", -1);
+    run("cached inserts", CB_STREAM_CACHED);
+    run("non-temporal inserts", CB_STREAM_NONTEMPORAL);
+
+    free(chase);
+    free(chunk);
+    free(storage);
+    return 0;
+}
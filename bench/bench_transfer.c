@@ -0,0 +1,116 @@
+/*
+    @file    bench_transfer.c
+    @brief   Bounce-buffer glue (cb_remove_bulk + cb_insert_bulk) versus cb_transfer.
+
+    @date 2026-10-18
+    @version 1.0
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "cb.h"
+#include "cb_transfer.h"
+
+#define RING_ITEMS  8192
+#define BATCH       1500
+#define TOTAL       (1 << 25)
+
+static CbItem src_storage[RING_ITEMS];
+static CbItem dst_storage[RING_ITEMS];
+static CbItem chunk[BATCH];
+static CbItem tmp[BATCH];
+static cb src;
+static cb dst;
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/* Feed the source and drain the destination the same way in both modes */
+static void produce(void) {
+    cb_span_t spans[2];
+    CbIndex available;
+    if (cb_get_write_spans_ex(&src, spans, &available) == CB_SUCCESS) {
+        CbIndex n = (available < BATCH) ? available : BATCH;
+        CbIndex first = (n < spans[0].count) ? n : spans[0].count;
+        memcpy(spans[0].data, chunk, first * sizeof(CbItem));
+        if (n > first) {
+            memcpy(spans[1].data, chunk + first, (n - first) * sizeof(CbItem));
+        }
+        cb_commit_write_ex(&src, n);
+    }
+}
+
+static unsigned consume(void) {
+    cb_span_t spans[2];
+    CbIndex available;
+    unsigned sum = 0;
+    if (cb_get_read_spans_ex(&dst, spans, &available) == CB_SUCCESS) {
+        for (int s = 0; s < 2; s++) {
+            for (CbIndex i = 0; i < spans[s].count; i++) {
+                sum += spans[s].data[i];
+            }
+        }
+        cb_commit_read_ex(&dst, available);
+    }
+    return sum;
+}
+
+static double run_bounce(unsigned *checksum) {
+    double start = now_sec();
+
+    for (size_t done = 0; done < TOTAL; done += BATCH) {
+        CbIndex removed, inserted;
+        produce();
+        cb_remove_bulk_ex(&src, tmp, BATCH, &removed);
+        cb_insert_bulk_ex(&dst, tmp, removed, &inserted);
+        *checksum += consume();
+    }
+
+    return now_sec() - start;
+}
+
+static double run_transfer(unsigned *checksum) {
+    double start = now_sec();
+
+    for (size_t done = 0; done < TOTAL; done += BATCH) {
+        CbIndex moved;
+        produce();
+        cb_transfer(&dst, &src, BATCH, NULL, NULL, &moved);
+        *checksum += consume();
+    }
+
+    return now_sec() - start;
+}
+
+int main() {
+    for (int i = 0; i < BATCH; i++) {
+        chunk[i] = (CbItem)(i * 7);
+    }
+
+    printf("Ring-to-ring transfer benchmark\n");
+    printf("Items: %d, batch: %d\n\n", TOTAL, BATCH);
+
+    unsigned sum_bounce = 0;
+    unsigned sum_transfer = 0;
+
+    cb_init(&src, src_storage, RING_ITEMS);
+    cb_init(&dst, dst_storage, RING_ITEMS);
+    double bounce = run_bounce(&sum_bounce);
+
+    cb_init(&src, src_storage, RING_ITEMS);
+    cb_init(&dst, dst_storage, RING_ITEMS);
+    double transfer = run_transfer(&sum_transfer);
+
+    printf("%-22s %12s %14s %12s\n", "mode", "time (ms)", "items/s", "checksum");
+    printf("%-22s %12.1f %14.0f %12u\n", "remove+insert bulk", bounce * 1e3, TOTAL / bounce, sum_bounce);
+    printf("%-22s %12.1f %14.0f %12u\n", "cb_transfer", transfer * 1e3, TOTAL / transfer, sum_transfer);
+    printf("\nSpeedup: %.2fx\n", bounce / transfer);
+    return 0;
+}
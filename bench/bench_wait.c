@@ -0,0 +1,111 @@
+/*
+    @file    bench_wait.c
+    @brief   Insert cost of a blocking-capable ring: plain cb inserts versus
+             cb_wait with a full fence per insert (symmetric) or with the
+             fence moved to the sleeping consumer via membarrier (asymmetric).
+
+    @date 2026-10-18
+    @version 1.0
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <time.h>
+#include "cb_wait.h"
+
+#define RING_ITEMS  1024
+#define ITERATIONS  (1 << 24)
+#define BURSTS      2000
+#define BURST_ITEMS 512
+
+static CbItem storage[RING_ITEMS];
+static cb ring;
+static cb_wait_t w;
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/* Single thread: insert then remove, so the ring never fills and nobody sleeps */
+static void run_insert(const char *name, int mode) {
+    CbItem item;
+
+    cb_init_ex(&ring, storage, RING_ITEMS);
+    if (mode >= 0) {
+        cb_wait_init(&w, &ring, (cb_wait_mode_t)mode);
+    }
+
+    double start = now_sec();
+    for (unsigned i = 0; i < ITERATIONS; i++) {
+        if (mode < 0) {
+            cb_insert_ex(&ring, (CbItem)i);
+        } else {
+            cb_wait_insert(&w, (CbItem)i);
+        }
+        cb_remove_ex(&ring, &item);
+    }
+    double elapsed = now_sec() - start;
+
+    printf("%-20s %14.2f\n", name, elapsed * 1e9 / ITERATIONS);
+}
+
+static void *burst_producer(void *arg) {
+    (void)arg;
+    for (unsigned b = 0; b < BURSTS; b++) {
+        for (unsigned i = 0; i < BURST_ITEMS;) {
+            if (cb_wait_insert(&w, (CbItem)i) == CB_SUCCESS) {
+                i++;
+            } else {
+                sched_yield();
+            }
+        }
+        usleep(50);  // Idle gap so the consumer goes to sleep
+    }
+    return NULL;
+}
+
+/* Producer bursts with idle gaps; the consumer blocks in cb_wait_remove() */
+static void run_blocking(const char *name, cb_wait_mode_t mode) {
+    pthread_t producer;
+    CbItem item;
+
+    cb_init_ex(&ring, storage, RING_ITEMS);
+    cb_wait_init(&w, &ring, mode);
+
+    double start = now_sec();
+    pthread_create(&producer, NULL, burst_producer, NULL);
+    for (unsigned i = 0; i < BURSTS * BURST_ITEMS; i++) {
+        cb_wait_remove(&w, &item, CB_WAIT_FOREVER);
+    }
+    pthread_join(producer, NULL);
+    double elapsed = now_sec() - start;
+
+    printf("%-20s %12.1f %10llu %10llu\n", name, elapsed * 1e3, (unsigned long long)w.sleeps,
+           (unsigned long long)w.wakes);
+}
+
+int main() {
+    printf("Blocking wait fence benchmark\n");
+    printf("CPUs online: %ld\n\n", sysconf(_SC_NPROCESSORS_ONLN));
+
+    cb_wait_init(&w, &ring, CB_WAIT_ASYMMETRIC);
+    printf("membarrier private expedited: %s\n\n", w.mode == CB_WAIT_ASYMMETRIC ? "yes" : "no");
+
+    printf("%-20s %14s\n", "insert path", "ns/insert");
+    run_insert("plain cb_insert", -1);
+    run_insert("cb_wait symmetric", CB_WAIT_SYMMETRIC);
+    run_insert("cb_wait asymmetric", CB_WAIT_ASYMMETRIC);
+
+    printf("\n%-20s %12s %10s %10s\n", "blocking consumer", "time (ms)", "sleeps", "wakes");
+    run_blocking("symmetric", CB_WAIT_SYMMETRIC);
+    run_blocking("asymmetric", CB_WAIT_ASYMMETRIC);
+    return 0;
+}
@@ -47,26 +47,10 @@
 */
 
 #include "cb.h"
+#include "cb_internal.h"
 #include <string.h>  // For memset
 #include <time.h>    // For timespec_get in timeout functions
 
-/* Internal helper macros for error handling */
-#define CB_SET_ERROR(cb_ptr, err_code, err_func, err_param, err_line) \
-    do { \
-        if (cb_ptr) { \
-            (cb_ptr)->last_error.code = (err_code); \
-            (cb_ptr)->last_error.function = (err_func); \
-            (cb_ptr)->last_error.parameter = (err_param); \
-            (cb_ptr)->last_error.line = (err_line); \
-        } \
-    } while(0)
-
-#define CB_RETURN_ERROR(cb_ptr, err_code, err_param) \
-    do { \
-        CB_SET_ERROR(cb_ptr, err_code, __func__, err_param, __LINE__); \
-        return err_code; \
-    } while(0)
-
 /* Atomic operations wrappers for C11 atomics */
 #if CB_HAS_C11_ATOMICS
     #define CB_ATOMIC_LOAD_IN(cb_ptr)  atomic_load(&(cb_ptr)->in)
@@ -86,6 +70,14 @@
     #define CB_ATOMIC_STORE_OW(cb_ptr, val)  CB_ATOMIC_STORE(&(cb_ptr)->overwrite, (val))
 #endif
 
+/* CbAtomicIndex fields (CB_C11_LAYOUT 0) may be narrower than CbIndex; the
+   largest index, length - 1, must survive the round trip through them */
+#if CB_C11_LAYOUT
+    #define CB_INDEX_FITS(length) true
+#else
+    #define CB_INDEX_FITS(length) ((CbIndex)(CbAtomicIndex)((length) - 1) == (length) - 1)
+#endif
+
 /* Statistics storage - one per buffer */
 typedef struct {
     CbIndex peak_usage;
@@ -148,6 +140,21 @@ static void cb_update_stats(cb *const cb_ptr, CbIndex data_size, bool is_insert,
         }
     }
 }
+
+/* Helper function to account a batch of successful transfers at once */
+static void cb_update_stats_count(cb *const cb_ptr, CbIndex data_size, bool is_insert, CbIndex count) {
+    int idx = cb_find_or_register_buffer(cb_ptr);
+    if (idx < 0) return;
+    
+    if (is_insert) {
+        cb_stats[idx].total_inserts += count;
+        if (data_size > cb_stats[idx].peak_usage) {
+            cb_stats[idx].peak_usage = data_size;
+        }
+    } else {
+        cb_stats[idx].total_removes += count;
+    }
+}
 #else
 /* Stub functions when statistics are disabled */
 static int cb_find_or_register_buffer(cb *const cb_ptr) {
@@ -161,6 +168,13 @@ static void cb_update_stats(cb *const cb_ptr, CbIndex data_size, bool is_insert,
     (void)is_insert;   /* Unused parameter */
     (void)is_success;  /* Unused parameter */
 }
+
+static void cb_update_stats_count(cb *const cb_ptr, CbIndex data_size, bool is_insert, CbIndex count) {
+    (void)cb_ptr;      /* Unused parameter */
+    (void)data_size;   /* Unused parameter */
+    (void)is_insert;   /* Unused parameter */
+    (void)count;       /* Unused parameter */
+}
 #endif /* CB_ENABLE_STATISTICS */
 
 void cb_init(cb *const cb_ptr, CbItem bufferStorage[], CbIndex bufferLength) {
@@ -186,8 +200,8 @@ cb_result_t cb_init_ex(cb *const cb_ptr, CbItem bufferStorage[], CbIndex bufferL
     /* Register for statistics */
     cb_find_or_register_buffer(cb_ptr);
     
-    if (bufferLength == 0) {
-        /* Initialize all fields even for zero-size buffer */
+    if (bufferLength == 0 || !CB_INDEX_FITS(bufferLength)) {
+        /* Initialize all fields even for an unusable size */
         cb_ptr->buf = bufferStorage;
         cb_ptr->size = 0;
         
@@ -565,6 +579,153 @@ cb_result_t cb_remove_bulk_ex(cb *cb_ptr, CbItem *items, CbIndex count, CbIndex
     return (*removed > 0) ? CB_SUCCESS : last_error;
 }
 
+CbIndex cb_get_read_spans(cb *cb_ptr, cb_span_t spans[2]) {
+    CbIndex available = 0;
+    cb_get_read_spans_ex(cb_ptr, spans, &available);
+    return available;
+}
+
+cb_result_t cb_get_read_spans_ex(cb *cb_ptr, cb_span_t spans[2], CbIndex *available) {
+    if (!cb_ptr || !spans || !available) {
+        return CB_ERROR_NULL_POINTER;
+    }
+    
+    spans[0].data = NULL;
+    spans[0].count = 0;
+    spans[1].data = NULL;
+    spans[1].count = 0;
+    *available = 0;
+    
+    if (cb_ptr->size == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+    
+    CbIndex current_out = CB_ATOMIC_LOAD(&cb_ptr->out);
+    CbIndex current_in = cb_internal_load_in(cb_ptr);
+    
+    if (current_out == current_in) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+    
+    spans[0].data = &cb_ptr->buf[current_out];
+    if (current_in > current_out) {
+        spans[0].count = current_in - current_out;
+    } else {
+        spans[0].count = cb_ptr->size - current_out;
+        if (current_in > 0) {
+            spans[1].data = &cb_ptr->buf[0];
+            spans[1].count = current_in;
+        }
+    }
+    
+    *available = spans[0].count + spans[1].count;
+    return CB_SUCCESS;
+}
+
+CbIndex cb_get_write_spans(cb *cb_ptr, cb_span_t spans[2]) {
+    CbIndex available = 0;
+    cb_get_write_spans_ex(cb_ptr, spans, &available);
+    return available;
+}
+
+cb_result_t cb_get_write_spans_ex(cb *cb_ptr, cb_span_t spans[2], CbIndex *available) {
+    if (!cb_ptr || !spans || !available) {
+        return CB_ERROR_NULL_POINTER;
+    }
+    
+    spans[0].data = NULL;
+    spans[0].count = 0;
+    spans[1].data = NULL;
+    spans[1].count = 0;
+    *available = 0;
+    
+    if (cb_ptr->size == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+    
+    CbIndex current_in = CB_ATOMIC_LOAD(&cb_ptr->in);
+    CbIndex current_out = cb_internal_load_out(cb_ptr);
+    
+    /* One slot always stays empty to tell full from empty */
+    CbIndex free_slots = (cb_ptr->size - 1) - cb_internal_used(current_in, current_out, cb_ptr->size);
+    if (free_slots == 0) {
+        return CB_ERROR_BUFFER_FULL;
+    }
+    
+    CbIndex first = cb_ptr->size - current_in;
+    spans[0].data = &cb_ptr->buf[current_in];
+    if (free_slots <= first) {
+        spans[0].count = free_slots;
+    } else {
+        spans[0].count = first;
+        spans[1].data = &cb_ptr->buf[0];
+        spans[1].count = free_slots - first;
+    }
+    
+    *available = free_slots;
+    return CB_SUCCESS;
+}
+
+bool cb_commit_read(cb *cb_ptr, CbIndex count) {
+    return cb_commit_read_ex(cb_ptr, count) == CB_SUCCESS;
+}
+
+cb_result_t cb_commit_read_ex(cb *cb_ptr, CbIndex count) {
+    if (!cb_ptr) {
+        return CB_ERROR_NULL_POINTER;
+    }
+    
+    if (cb_ptr->size == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+    
+    CbIndex current_out = CB_ATOMIC_LOAD(&cb_ptr->out);
+    CbIndex current_in = cb_internal_load_in(cb_ptr);
+    CbIndex used = cb_internal_used(current_in, current_out, cb_ptr->size);
+    
+    if (count > used) {
+        CB_RETURN_ERROR(cb_ptr, CB_ERROR_INVALID_COUNT, "count");
+    }
+    
+    if (count == 0) {
+        return CB_SUCCESS;
+    }
+    
+    cb_internal_publish_out(cb_ptr, cb_internal_advance(current_out, count, cb_ptr->size));
+    cb_update_stats_count(cb_ptr, used - count, false, count);
+    return CB_SUCCESS;
+}
+
+bool cb_commit_write(cb *cb_ptr, CbIndex count) {
+    return cb_commit_write_ex(cb_ptr, count) == CB_SUCCESS;
+}
+
+cb_result_t cb_commit_write_ex(cb *cb_ptr, CbIndex count) {
+    if (!cb_ptr) {
+        return CB_ERROR_NULL_POINTER;
+    }
+    
+    if (cb_ptr->size == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+    
+    CbIndex current_in = CB_ATOMIC_LOAD(&cb_ptr->in);
+    CbIndex current_out = cb_internal_load_out(cb_ptr);
+    CbIndex used = cb_internal_used(current_in, current_out, cb_ptr->size);
+    
+    if (count > (cb_ptr->size - 1) - used) {
+        CB_RETURN_ERROR(cb_ptr, CB_ERROR_INVALID_COUNT, "count");
+    }
+    
+    if (count == 0) {
+        return CB_SUCCESS;
+    }
+    
+    cb_internal_publish_in(cb_ptr, cb_internal_advance(current_in, count, cb_ptr->size));
+    cb_update_stats_count(cb_ptr, used + count, true, count);
+    return CB_SUCCESS;
+}
+
 void cb_set_overwrite(cb *cb_ptr, bool enable) {
     cb_set_overwrite_ex(cb_ptr, enable);
 }
@@ -620,6 +781,8 @@ const char* cb_error_string(cb_result_t error) {
             return "Operation timed out";
         case CB_ERROR_INVALID_PARAMETER:
             return "Invalid parameter value";
+        case CB_ERROR_IO:
+            return "System call failed";
         default:
             return "Unknown error";
     }
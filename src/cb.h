@@ -30,6 +30,10 @@
        - `cb_set_overwrite()`: Enable/disable overwrite mode
        - `cb_insert_timeout()`: Add item with timeout
        - `cb_remove_timeout()`: Retrieve item with timeout
+       - `cb_get_read_spans()`: Zero-copy view of stored items
+       - `cb_commit_read()`: Release items consumed through read spans
+       - `cb_get_write_spans()`: Zero-copy view of free slots
+       - `cb_commit_write()`: Publish items written through write spans
 
     @note This implementation is suitable for 1-producer, 1-consumer scenarios.
          Index types and memory fencing are adapted per platform for correctness.
@@ -93,7 +97,8 @@ typedef enum {
     CB_ERROR_INVALID_COUNT,         // Invalid count parameter for bulk operations
     CB_ERROR_BUFFER_CORRUPTED,      // Buffer integrity check failed
     CB_ERROR_TIMEOUT,               // Operation timed out
-    CB_ERROR_INVALID_PARAMETER      // Invalid parameter value
+    CB_ERROR_INVALID_PARAMETER,     // Invalid parameter value
+    CB_ERROR_IO                     // Underlying system call failed (see errno)
 } cb_result_t;
 
 /* Error context information */
@@ -117,16 +122,50 @@ typedef struct {
         (sizeof(CbAtomicIndex) <= sizeof(CbIndex)) ? 1 : -1];
 #endif
 
+/*
+ * Index field layout. C and C++ translation units must agree on it, so it
+ * follows the compiler, never the language. Define it on the command line
+ * to pin it when the library and its callers use different toolchains.
+ *   1: the C11 layout, CbIndex-wide indices and a bool flag; plain fields
+ *      of the same size in other builds, accessed through the GCC/Clang
+ *      builtins
+ *   0: CbAtomicIndex fields
+ */
+#ifndef CB_C11_LAYOUT
+    #if CB_HAS_C11_ATOMICS || defined(__GNUC__) || defined(__clang__)
+        #define CB_C11_LAYOUT 1
+    #elif defined(__cplusplus)
+        #error "Define CB_C11_LAYOUT to the value the cb library was built with"
+    #else
+        #define CB_C11_LAYOUT 0
+    #endif
+#endif
+
+#if CB_C11_LAYOUT && CB_HAS_C11_ATOMICS
+    _Static_assert(sizeof(_Atomic(CbIndex)) == sizeof(CbIndex) && sizeof(atomic_bool) == sizeof(bool),
+                   "C11 index fields must match their plain counterparts");
+#endif
+
+/* Index loads and stores must not tear, whatever the index width */
+#if CB_HAS_C11_ATOMICS && !defined(__cplusplus)
+    _Static_assert(sizeof(CbIndex) < 8 || ATOMIC_LONG_LOCK_FREE == 2 || ATOMIC_LLONG_LOCK_FREE == 2,
+                   "64-bit CbIndex needs lock-free 64-bit atomics");
+#endif
+
 /* Buffer structure */
 typedef struct
 {
     CbItem *buf;
     CbIndex size;
     
-#if CB_HAS_C11_ATOMICS
-    atomic_uint in;
-    atomic_uint out;
+#if CB_C11_LAYOUT && CB_HAS_C11_ATOMICS
+    _Atomic(CbIndex) in;            // Full CbIndex width, so rings may exceed 4 Gi items
+    _Atomic(CbIndex) out;
     atomic_bool overwrite;
+#elif CB_C11_LAYOUT
+    CbIndex in;
+    CbIndex out;
+    bool overwrite;
 #else
     CbAtomicIndex in;
     CbAtomicIndex out;
@@ -175,6 +214,26 @@ CbIndex cb_remove_bulk(cb *cb_ptr, CbItem *items, CbIndex count);
 cb_result_t cb_insert_bulk_ex(cb *cb_ptr, const CbItem *items, CbIndex count, CbIndex *inserted);
 cb_result_t cb_remove_bulk_ex(cb *cb_ptr, CbItem *items, CbIndex count, CbIndex *removed);
 
+/* Zero-copy access
+ * A ring region is exposed as at most two contiguous spans (before and after
+ * the wrap point). Read spans are owned by the consumer, write spans by the
+ * producer; nothing becomes visible to the other side until committed. */
+typedef struct {
+    CbItem *data;                   // First item of the contiguous segment
+    CbIndex count;                  // Number of items in the segment
+} cb_span_t;
+
+CbIndex cb_get_read_spans(cb *cb_ptr, cb_span_t spans[2]);
+CbIndex cb_get_write_spans(cb *cb_ptr, cb_span_t spans[2]);
+bool cb_commit_read(cb *cb_ptr, CbIndex count);
+bool cb_commit_write(cb *cb_ptr, CbIndex count);
+
+/* Enhanced zero-copy access with error codes */
+cb_result_t cb_get_read_spans_ex(cb *cb_ptr, cb_span_t spans[2], CbIndex *available);
+cb_result_t cb_get_write_spans_ex(cb *cb_ptr, cb_span_t spans[2], CbIndex *available);
+cb_result_t cb_commit_read_ex(cb *cb_ptr, CbIndex count);
+cb_result_t cb_commit_write_ex(cb *cb_ptr, CbIndex count);
+
 /* Overwrite control */
 void cb_set_overwrite(cb *cb_ptr, bool enable);
 bool cb_get_overwrite(const cb *cb_ptr);
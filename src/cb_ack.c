@@ -0,0 +1,135 @@
+/*
+    @file        cb_ack.h / cb_ack.c
+    @brief       Lazy consumer acknowledgement: publish `out` per batch instead of per item
+    @details
+     - See cb_ack.h for the release rules.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include <string.h>
+#include "cb_ack.h"
+#include "cb_internal.h"
+
+/* Unread items past the pending ones; re-reads `in` only when none seem left */
+static CbIndex cb_ack_unread(cb_ack_t *a) {
+    cb *ring = a->ring;
+    CbIndex out = (CbIndex)CB_ATOMIC_LOAD(&ring->out);
+    CbIndex unread = cb_internal_used(a->cached_in, out, ring->size) - a->pending;
+
+    if (unread == 0) {
+        a->cached_in = cb_internal_load_in(ring);
+        unread = cb_internal_used(a->cached_in, out, ring->size) - a->pending;
+    }
+    return unread;
+}
+
+static void cb_ack_publish(cb_ack_t *a) {
+    if (a->pending == 0) {
+        return;
+    }
+
+    cb_commit_read_ex(a->ring, a->pending);
+    a->pending = 0;
+    a->releases++;
+}
+
+cb_result_t cb_ack_init(cb_ack_t *a, cb *ring, CbIndex batch) {
+    if (!a || !ring) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (ring->size < 2) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    if (batch == 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    a->ring = ring;
+    a->pending = 0;
+    a->cached_in = cb_internal_load_in(ring);
+    a->batch = batch;
+    a->releases = 0;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_ack_remove(cb_ack_t *a, CbItem *item) {
+    if (!a || !item) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    CbIndex unread = cb_ack_unread(a);
+    if (unread == 0) {
+        cb_ack_publish(a);
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    cb *ring = a->ring;
+    *item = ring->buf[cb_internal_advance((CbIndex)CB_ATOMIC_LOAD(&ring->out), a->pending, ring->size)];
+
+    /* Release per batch, and whenever everything seen has been read */
+    if (++a->pending >= a->batch || unread == 1) {
+        cb_ack_publish(a);
+    }
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_ack_remove_bulk(cb_ack_t *a, CbItem *items, CbIndex count, CbIndex *removed) {
+    if (!a || !items || !removed) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *removed = 0;
+    if (count == 0) {
+        CB_RETURN_ERROR(a->ring, CB_ERROR_INVALID_COUNT, "count");
+    }
+
+    CbIndex unread = cb_ack_unread(a);
+    if (unread == 0) {
+        cb_ack_publish(a);
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    cb *ring = a->ring;
+    CbIndex n = (count < unread) ? count : unread;
+    CbIndex pos = cb_internal_advance((CbIndex)CB_ATOMIC_LOAD(&ring->out), a->pending, ring->size);
+    CbIndex first = ring->size - pos;
+    if (first > n) {
+        first = n;
+    }
+    memcpy(items, &ring->buf[pos], (size_t)first * sizeof(CbItem));
+    memcpy(items + first, &ring->buf[0], (size_t)(n - first) * sizeof(CbItem));
+
+    a->pending += n;
+    *removed = n;
+
+    if (a->pending >= a->batch || n == unread) {
+        cb_ack_publish(a);
+    }
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_ack_release(cb_ack_t *a) {
+    if (!a) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    cb_ack_publish(a);
+    return CB_SUCCESS;
+}
+
+CbIndex cb_ack_count(cb_ack_t *a) {
+    if (!a) {
+        return 0;
+    }
+
+    cb *ring = a->ring;
+    return cb_internal_used(cb_internal_load_in(ring), (CbIndex)CB_ATOMIC_LOAD(&ring->out), ring->size) -
+           a->pending;
+}
@@ -0,0 +1,67 @@
+/*
+    @file        cb_ack.h / cb_ack.c
+    @brief       Lazy consumer acknowledgement: publish `out` per batch instead of per item
+    @details
+     - Items are read from the slots past `out` and counted as consumed, but
+       their slots are only handed back to the producer when `out` is stored:
+         - after `batch` items;
+         - when the ring looks empty (nothing left to read past the consumed
+           items), so an idle consumer never holds slots back;
+         - on `cb_ack_release()`.
+     - The producer index is cached and only re-read when the cached value
+       says nothing is left, so the consumer touches the producer's cache line
+       once per drained batch rather than once per item.
+     - Occupancy stays exact for the producer: slots are reused only after
+       they are released, and `cb_freeSpace()` never reports a slot the
+       consumer still reads from. Unreleased items are simply counted as
+       occupied a little longer.
+
+     Public API:
+       - `cb_ack_init()`        : Attach a lazy consumer to a ring
+       - `cb_ack_remove()`      : Read one item, releasing per batch
+       - `cb_ack_remove_bulk()` : Read several items, releasing per batch
+       - `cb_ack_release()`     : Release everything read so far
+       - `cb_ack_count()`       : Items still unread (exact, from the consumer side)
+
+    @note Read through `cb_ack_*()` only while attached; `cb_dataSize()` on the
+         consumer side also counts read but unreleased items.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_ACK_H
+#define CB_ACK_H
+
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Lazy consumer */
+typedef struct {
+    cb *ring;                       // Underlying buffer
+    CbIndex pending;                // Items read past `out`, not yet released
+    CbIndex cached_in;              // Last producer index seen
+    CbIndex batch;                  // Release after this many items
+    uint64_t releases;              // Stores of `out` so far
+} cb_ack_t;
+
+/* Initialization */
+cb_result_t cb_ack_init(cb_ack_t *a, cb *ring, CbIndex batch);
+
+/* Consumer */
+cb_result_t cb_ack_remove(cb_ack_t *a, CbItem *item);
+cb_result_t cb_ack_remove_bulk(cb_ack_t *a, CbItem *items, CbIndex count, CbIndex *removed);
+cb_result_t cb_ack_release(cb_ack_t *a);
+CbIndex cb_ack_count(cb_ack_t *a);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_ACK_H */
@@ -0,0 +1,304 @@
+/*
+    @file        cb_actor.h / cb_actor.c
+    @brief       Actor runtime: lock-free multi-sender mailboxes and a worker pool (Linux)
+    @details
+     - See cb_actor.h for the scheduling rules.
+     - Mailboxes and the run queue are bounded queues with a sequence number
+       per slot. Slot `i` starts at `seq = i`. A writer owns the slot at
+       position `pos` when `seq == pos` and hands it over with `seq = pos + 1`;
+       the reader returns it for the next lap with `seq = pos + capacity`.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // For syscall
+#endif
+
+#include "cb_actor.h"
+#include <limits.h>
+#include <string.h>  // For memset
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+#define CB_ACTOR_LOAD(ptr)          __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define CB_ACTOR_STORE(ptr, val)    __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+#define CB_ACTOR_CAS(ptr, exp, val) \
+    __atomic_compare_exchange_n((ptr), (exp), (val), true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)
+
+static bool cb_actor_power_of_two(size_t n) {
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+/* Append an actor to the run queue and wake a sleeping worker */
+static void cb_actor_enqueue(cb_actor_runtime_t *rt, cb_actor_t *actor) {
+    size_t pos = __atomic_load_n(&rt->tail, __ATOMIC_RELAXED);
+    cb_actor_run_slot_t *slot;
+
+    /* Never full: each registered actor is queued at most once */
+    for (;;) {
+        slot = &rt->slots[pos & rt->mask];
+        intptr_t diff = (intptr_t)CB_ACTOR_LOAD(&slot->seq) - (intptr_t)pos;
+        if (diff == 0) {
+            if (CB_ACTOR_CAS(&rt->tail, &pos, pos + 1)) {
+                break;
+            }
+        } else {
+            pos = __atomic_load_n(&rt->tail, __ATOMIC_RELAXED);
+        }
+    }
+
+    slot->actor = actor;
+    CB_ACTOR_STORE(&slot->seq, pos + 1);
+
+    __atomic_fetch_add(&rt->signal, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&rt->sleepers, __ATOMIC_SEQ_CST) != 0) {
+        syscall(SYS_futex, &rt->signal, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+    }
+}
+
+/* Take the next scheduled actor, or NULL */
+static cb_actor_t *cb_actor_dequeue(cb_actor_runtime_t *rt) {
+    size_t pos = __atomic_load_n(&rt->head, __ATOMIC_RELAXED);
+    cb_actor_run_slot_t *slot;
+
+    for (;;) {
+        slot = &rt->slots[pos & rt->mask];
+        intptr_t diff = (intptr_t)CB_ACTOR_LOAD(&slot->seq) - (intptr_t)(pos + 1);
+        if (diff == 0) {
+            if (CB_ACTOR_CAS(&rt->head, &pos, pos + 1)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return NULL;
+        } else {
+            pos = __atomic_load_n(&rt->head, __ATOMIC_RELAXED);
+        }
+    }
+
+    cb_actor_t *actor = slot->actor;
+    CB_ACTOR_STORE(&slot->seq, pos + rt->mask + 1);
+    return actor;
+}
+
+/* True when the mailbox slot at `head` holds a published message */
+static bool cb_actor_pending(const cb_actor_t *actor, size_t head) {
+    const cb_actor_slot_t *slot = &actor->slots[head & actor->mask];
+    return CB_ACTOR_LOAD(&slot->seq) == head + 1;
+}
+
+/* Queue an idle actor; only the caller that flips the flag does it */
+static void cb_actor_schedule(cb_actor_t *actor) {
+    uint32_t idle = 0;
+    if (__atomic_compare_exchange_n(&actor->scheduled, &idle, 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) {
+        cb_actor_enqueue(actor->runtime, actor);
+    }
+}
+
+/* Handle up to `batch` messages, then requeue or go idle */
+static unsigned cb_actor_turn(cb_actor_runtime_t *rt, cb_actor_t *actor) {
+    unsigned handled = 0;
+
+    while (handled < rt->batch && cb_actor_pending(actor, actor->head)) {
+        cb_actor_slot_t *slot = &actor->slots[actor->head & actor->mask];
+        cb_actor_msg_t msg = slot->msg;
+        CB_ACTOR_STORE(&slot->seq, actor->head + actor->mask + 1);
+        actor->head++;
+
+        actor->fn(actor, &msg, actor->ctx);
+        handled++;
+    }
+    actor->processed += handled;
+    actor->turns++;
+
+    /* `head` belongs to the next worker once `scheduled` is cleared; keep a copy */
+    const size_t head = actor->head;
+    if (cb_actor_pending(actor, head)) {
+        /* Batch used up; let the other scheduled actors run first */
+        cb_actor_enqueue(rt, actor);
+        return handled;
+    }
+
+    /* Go idle, then look again: a sender that saw us scheduled did not queue us */
+    __atomic_store_n(&actor->scheduled, 0, __ATOMIC_SEQ_CST);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (cb_actor_pending(actor, head)) {
+        cb_actor_schedule(actor);
+    }
+    return handled;
+}
+
+static void *cb_actor_worker(void *arg) {
+    cb_actor_runtime_t *rt = (cb_actor_runtime_t *)arg;
+    unsigned idle = 0;
+
+    for (;;) {
+        /* Sample before checking `stop`; cb_actor_stop() bumps it after setting `stop` */
+        uint32_t signal = __atomic_load_n(&rt->signal, __ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&rt->stop, __ATOMIC_ACQUIRE)) {
+            break;
+        }
+
+        cb_actor_t *actor = cb_actor_dequeue(rt);
+        if (actor) {
+            cb_actor_turn(rt, actor);
+            idle = 0;
+            continue;
+        }
+
+        if (++idle < CB_ACTOR_IDLE_SPIN) {
+            continue;
+        }
+
+        /* Sleep until an actor is queued after `signal` was sampled */
+        __atomic_fetch_add(&rt->sleepers, 1, __ATOMIC_SEQ_CST);
+        syscall(SYS_futex, &rt->signal, FUTEX_WAIT_PRIVATE, signal, NULL, NULL, 0);
+        __atomic_fetch_sub(&rt->sleepers, 1, __ATOMIC_SEQ_CST);
+    }
+    return NULL;
+}
+
+cb_result_t cb_actor_runtime_init(cb_actor_runtime_t *rt, cb_actor_run_slot_t slots[], size_t capacity,
+                                  unsigned batch) {
+    if (!rt || !slots) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (!cb_actor_power_of_two(capacity)) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    if (batch == 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    memset(rt, 0, sizeof(*rt));
+    for (size_t i = 0; i < capacity; i++) {
+        slots[i].seq = i;
+        slots[i].actor = NULL;
+    }
+    rt->slots = slots;
+    rt->mask = capacity - 1;
+    rt->batch = batch;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_actor_init(cb_actor_runtime_t *rt, cb_actor_t *actor, cb_actor_slot_t slots[], size_t capacity,
+                          cb_actor_fn_t fn, void *ctx) {
+    if (!rt || !actor || !slots || !fn) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (!cb_actor_power_of_two(capacity)) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    /* The run queue has to hold every actor at once */
+    if (rt->actors > rt->mask) {
+        return CB_ERROR_BUFFER_FULL;
+    }
+
+    memset(actor, 0, sizeof(*actor));
+    for (size_t i = 0; i < capacity; i++) {
+        slots[i].seq = i;
+    }
+    actor->fn = fn;
+    actor->ctx = ctx;
+    actor->runtime = rt;
+    actor->slots = slots;
+    actor->mask = capacity - 1;
+    rt->actors++;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_actor_send(cb_actor_t *actor, cb_actor_t *from, uint32_t type, uint64_t value) {
+    if (!actor) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    size_t pos = __atomic_load_n(&actor->tail, __ATOMIC_RELAXED);
+    cb_actor_slot_t *slot;
+
+    for (;;) {
+        slot = &actor->slots[pos & actor->mask];
+        intptr_t diff = (intptr_t)CB_ACTOR_LOAD(&slot->seq) - (intptr_t)pos;
+        if (diff == 0) {
+            if (CB_ACTOR_CAS(&actor->tail, &pos, pos + 1)) {
+                break;
+            }
+        } else if (diff < 0) {
+            /* The slot still holds the message from one lap ago */
+            return CB_ERROR_BUFFER_FULL;
+        } else {
+            pos = __atomic_load_n(&actor->tail, __ATOMIC_RELAXED);
+        }
+    }
+
+    slot->msg.from = from;
+    slot->msg.type = type;
+    slot->msg.value = value;
+    CB_ACTOR_STORE(&slot->seq, pos + 1);
+
+    /* Pairs with the fence in cb_actor_turn() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (!__atomic_load_n(&actor->scheduled, __ATOMIC_RELAXED)) {
+        cb_actor_schedule(actor);
+    }
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_actor_run_once(cb_actor_runtime_t *rt, unsigned *handled) {
+    if (!rt || !handled) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *handled = 0;
+    cb_actor_t *actor = cb_actor_dequeue(rt);
+    if (!actor) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    *handled = cb_actor_turn(rt, actor);
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_actor_start(cb_actor_runtime_t *rt, unsigned workers) {
+    if (!rt) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (workers == 0 || workers > CB_ACTOR_MAX_WORKERS || rt->workers != 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    __atomic_store_n(&rt->stop, 0, __ATOMIC_RELEASE);
+    for (unsigned i = 0; i < workers; i++) {
+        if (pthread_create(&rt->threads[i], NULL, cb_actor_worker, rt) != 0) {
+            cb_actor_stop(rt);
+            return CB_ERROR_IO;
+        }
+        rt->workers++;
+    }
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_actor_stop(cb_actor_runtime_t *rt) {
+    if (!rt) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    __atomic_store_n(&rt->stop, 1, __ATOMIC_RELEASE);
+    __atomic_fetch_add(&rt->signal, 1, __ATOMIC_SEQ_CST);
+    syscall(SYS_futex, &rt->signal, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+
+    for (unsigned i = 0; i < rt->workers; i++) {
+        pthread_join(rt->threads[i], NULL);
+    }
+    rt->workers = 0;
+    return CB_SUCCESS;
+}
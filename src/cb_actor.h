@@ -0,0 +1,135 @@
+/*
+    @file        cb_actor.h / cb_actor.c
+    @brief       Actor runtime: lock-free multi-sender mailboxes and a worker pool (Linux)
+    @details
+     - Every actor owns a bounded mailbox ring that any thread may send to
+       without a lock. Senders reserve a slot with one CAS on the tail and
+       publish it through a per-slot sequence number, so a sender that is
+       preempted mid-write never exposes a half-written message.
+     - An actor is either idle or scheduled. The send that finds it idle moves
+       it onto the runtime's run queue; later sends only append. An actor is
+       on the run queue at most once, so the queue never needs more slots than
+       there are actors.
+     - A turn handles at most `batch` messages. An actor with messages left
+       goes to the back of the run queue, so one busy actor cannot starve the
+       others.
+     - Idle actors are not on the run queue and cost nothing. Workers with
+       nothing to run sleep on a futex and are woken by the next send that
+       schedules an actor.
+
+     Public API:
+       - `cb_actor_runtime_init()` : Set up a runtime with its run queue storage
+       - `cb_actor_init()`         : Register an actor with its mailbox storage
+       - `cb_actor_send()`         : Post a message from any thread
+       - `cb_actor_run_once()`     : Run one scheduled turn in the calling thread
+       - `cb_actor_start()`        : Start N worker threads
+       - `cb_actor_stop()`         : Stop and join the workers
+
+    @note Mailbox and run queue capacities must be powers of two. Unlike a
+         `cb` ring, every slot is usable.
+
+    @note Actors must be registered before they receive messages and must
+         outlive the runtime's workers. A handler runs on one worker at a
+         time, so actor state needs no locking.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_ACTOR_H
+#define CB_ACTOR_H
+
+#include <stddef.h>
+#include <pthread.h>
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CB_ACTOR_MAX_WORKERS
+#define CB_ACTOR_MAX_WORKERS 16     // Worker threads per runtime
+#endif
+
+#ifndef CB_ACTOR_LINE_SIZE
+#define CB_ACTOR_LINE_SIZE 64       // Padding between sender and receiver indices
+#endif
+
+#ifndef CB_ACTOR_IDLE_SPIN
+#define CB_ACTOR_IDLE_SPIN 256      // Empty run queue polls before a worker sleeps
+#endif
+
+typedef struct cb_actor cb_actor_t;
+typedef struct cb_actor_runtime cb_actor_runtime_t;
+
+typedef struct {
+    cb_actor_t *from;               // Sender, or NULL
+    uint32_t type;                  // Application-defined message type
+    uint64_t value;                 // Application-defined payload
+} cb_actor_msg_t;
+
+typedef struct {
+    size_t seq;                     // Slot turn (see cb_actor.c)
+    cb_actor_msg_t msg;
+} cb_actor_slot_t;
+
+typedef struct {
+    size_t seq;
+    cb_actor_t *actor;
+} cb_actor_run_slot_t;
+
+/* Message handler; runs on a worker thread */
+typedef void (*cb_actor_fn_t)(cb_actor_t *self, const cb_actor_msg_t *msg, void *ctx);
+
+struct cb_actor {
+    cb_actor_fn_t fn;
+    void *ctx;
+    cb_actor_runtime_t *runtime;
+    cb_actor_slot_t *slots;
+    size_t mask;                    // Mailbox capacity - 1
+    uint32_t scheduled;             // Non-zero while queued or running
+    uint64_t processed;             // Messages handled
+    uint64_t turns;                 // Turns run
+    uint8_t pad0[CB_ACTOR_LINE_SIZE];
+    size_t tail;                    // Next slot to reserve (senders, CAS)
+    uint8_t pad1[CB_ACTOR_LINE_SIZE - sizeof(size_t)];
+    size_t head;                    // Next slot to handle (owning worker)
+    uint8_t pad2[CB_ACTOR_LINE_SIZE - sizeof(size_t)];
+};
+
+struct cb_actor_runtime {
+    cb_actor_run_slot_t *slots;
+    size_t mask;                    // Run queue capacity - 1
+    size_t actors;                  // Registered actors
+    unsigned batch;                 // Messages per turn
+    unsigned workers;               // Running worker threads
+    uint32_t stop;
+    uint32_t signal;                // Bumped when an actor is queued (futex word)
+    uint32_t sleepers;              // Workers asleep on `signal`
+    pthread_t threads[CB_ACTOR_MAX_WORKERS];
+    uint8_t pad0[CB_ACTOR_LINE_SIZE];
+    size_t tail;                    // Run queue producers
+    uint8_t pad1[CB_ACTOR_LINE_SIZE - sizeof(size_t)];
+    size_t head;                    // Run queue consumers
+    uint8_t pad2[CB_ACTOR_LINE_SIZE - sizeof(size_t)];
+};
+
+cb_result_t cb_actor_runtime_init(cb_actor_runtime_t *rt, cb_actor_run_slot_t slots[], size_t capacity,
+                                  unsigned batch);
+cb_result_t cb_actor_init(cb_actor_runtime_t *rt, cb_actor_t *actor, cb_actor_slot_t slots[], size_t capacity,
+                          cb_actor_fn_t fn, void *ctx);
+
+cb_result_t cb_actor_send(cb_actor_t *actor, cb_actor_t *from, uint32_t type, uint64_t value);
+
+cb_result_t cb_actor_run_once(cb_actor_runtime_t *rt, unsigned *handled);
+cb_result_t cb_actor_start(cb_actor_runtime_t *rt, unsigned workers);
+cb_result_t cb_actor_stop(cb_actor_runtime_t *rt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_ACTOR_H */
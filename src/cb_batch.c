@@ -0,0 +1,185 @@
+/*
+    @file        cb_batch.h / cb_batch.c
+    @brief       Producer-side batching: publish `in` per batch instead of per item
+    @details
+     - See cb_batch.h for the publication and adaptation rules.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include <string.h>
+#include "cb_batch.h"
+#include "cb_internal.h"
+
+/* Free slots past the pending items; re-reads `out` only when none seem left */
+static CbIndex cb_batch_room(cb_batch_t *b) {
+    cb *ring = b->ring;
+    CbIndex in = (CbIndex)CB_ATOMIC_LOAD(&ring->in);
+    CbIndex used = cb_internal_used(in, b->cached_out, ring->size) + b->pending;
+
+    if (used >= ring->size - 1) {
+        b->cached_out = cb_internal_load_out(ring);
+        used = cb_internal_used(in, b->cached_out, ring->size) + b->pending;
+    }
+    return (ring->size - 1) - used;
+}
+
+static bool cb_batch_expired(const cb_batch_t *b, uint64_t now) {
+    return b->pending > 0 && now >= b->first_ts && now - b->first_ts >= b->budget;
+}
+
+static void cb_batch_publish(cb_batch_t *b, unsigned reason) {
+    if (b->pending == 0) {
+        return;
+    }
+
+    cb_commit_write_ex(b->ring, b->pending);
+    b->pending = 0;
+    b->last_reason = reason;
+
+    if (reason == CB_BATCH_BY_COUNT) {
+        /* Heavy stream: larger batches, more time to fill them */
+        b->batch = (b->batch > b->batch_max / 2) ? b->batch_max : b->batch * 2;
+        b->budget = (b->budget == 0) ? 1 : b->budget * 2;
+        if (b->budget > b->budget_max) {
+            b->budget = b->budget_max;
+        }
+    } else if (reason == CB_BATCH_BY_TIME) {
+        /* Light stream: stop waiting for items that do not come */
+        b->batch = (b->batch / 2 < b->batch_min) ? b->batch_min : b->batch / 2;
+        b->budget = (b->budget / 2 < b->budget_min) ? b->budget_min : b->budget / 2;
+    }
+}
+
+/* Publish if either limit is hit */
+static void cb_batch_check(cb_batch_t *b, uint64_t now) {
+    if (b->pending >= b->batch) {
+        cb_batch_publish(b, CB_BATCH_BY_COUNT);
+    } else if (cb_batch_expired(b, now)) {
+        cb_batch_publish(b, CB_BATCH_BY_TIME);
+    }
+}
+
+cb_result_t cb_batch_init(cb_batch_t *b, cb *ring, CbIndex batch_min, CbIndex batch_max,
+                          uint64_t budget_min, uint64_t budget_max) {
+    if (!b || !ring) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (ring->size < 2) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    if (batch_min == 0 || batch_min > batch_max) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    if (budget_min > budget_max) {
+        return CB_ERROR_INVALID_PARAMETER;
+    }
+
+    /* A batch never needs to exceed the capacity */
+    if (batch_max > ring->size - 1) {
+        batch_max = ring->size - 1;
+    }
+    if (batch_min > batch_max) {
+        batch_min = batch_max;
+    }
+
+    b->ring = ring;
+    b->pending = 0;
+    b->cached_out = cb_internal_load_out(ring);
+    b->batch = batch_min;
+    b->batch_min = batch_min;
+    b->batch_max = batch_max;
+    b->budget = budget_min;
+    b->budget_min = budget_min;
+    b->budget_max = budget_max;
+    b->first_ts = 0;
+    b->last_reason = 0;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_batch_insert(cb_batch_t *b, CbItem item, uint64_t now) {
+    if (!b) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (cb_batch_room(b) == 0) {
+        /* Let the consumer see what is pending so it can make room */
+        cb_batch_publish(b, CB_BATCH_BY_FLUSH);
+        return CB_ERROR_BUFFER_FULL;
+    }
+
+    cb *ring = b->ring;
+    CbIndex pos = cb_internal_advance((CbIndex)CB_ATOMIC_LOAD(&ring->in), b->pending, ring->size);
+    ring->buf[pos] = item;
+
+    if (b->pending++ == 0) {
+        b->first_ts = now;
+    }
+
+    cb_batch_check(b, now);
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_batch_insert_bulk(cb_batch_t *b, const CbItem *items, CbIndex count, uint64_t now,
+                                 CbIndex *inserted) {
+    if (!b || !items || !inserted) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *inserted = 0;
+    if (count == 0) {
+        CB_RETURN_ERROR(b->ring, CB_ERROR_INVALID_COUNT, "count");
+    }
+
+    CbIndex room = cb_batch_room(b);
+    if (room == 0) {
+        cb_batch_publish(b, CB_BATCH_BY_FLUSH);
+        return CB_ERROR_BUFFER_FULL;
+    }
+
+    cb *ring = b->ring;
+    CbIndex n = (count < room) ? count : room;
+    CbIndex pos = cb_internal_advance((CbIndex)CB_ATOMIC_LOAD(&ring->in), b->pending, ring->size);
+    CbIndex first = ring->size - pos;
+    if (first > n) {
+        first = n;
+    }
+    memcpy(&ring->buf[pos], items, (size_t)first * sizeof(CbItem));
+    memcpy(&ring->buf[0], items + first, (size_t)(n - first) * sizeof(CbItem));
+
+    if (b->pending == 0) {
+        b->first_ts = now;
+    }
+    b->pending += n;
+    *inserted = n;
+
+    cb_batch_check(b, now);
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_batch_tick(cb_batch_t *b, uint64_t now) {
+    if (!b) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (cb_batch_expired(b, now)) {
+        cb_batch_publish(b, CB_BATCH_BY_TIME);
+    }
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_batch_flush(cb_batch_t *b) {
+    if (!b) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    cb_batch_publish(b, CB_BATCH_BY_FLUSH);
+    return CB_SUCCESS;
+}
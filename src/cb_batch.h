@@ -0,0 +1,84 @@
+/*
+    @file        cb_batch.h / cb_batch.c
+    @brief       Producer-side batching: publish `in` per batch instead of per item
+    @details
+     - Items are written into the free space past `in` but stay private to
+       the producer until published with a single store of `in`. That happens
+       when one of these holds:
+         - `batch` items are pending;
+         - the oldest pending item has waited `budget` time units (checked on
+           every insert and by `cb_batch_tick()`);
+         - `cb_batch_flush()` is called.
+     - The consumer index is cached and only re-read when the cached value
+       says the ring is full, so the producer touches the consumer's cache
+       line once per wrap rather than once per item.
+     - Both limits adapt to the load. A publish triggered by the count
+       (a heavy stream) doubles `batch` and `budget`, up to their maximums.
+       A publish triggered by the time budget (a light stream) halves both,
+       down to their minimums. Latency stays bounded by `budget_max`.
+
+     Public API:
+       - `cb_batch_init()`        : Attach a batching producer to a ring
+       - `cb_batch_insert()`      : Write one item, publishing if a limit is hit
+       - `cb_batch_insert_bulk()` : Write several items, publishing if a limit is hit
+       - `cb_batch_tick()`        : Publish if the time budget expired
+       - `cb_batch_flush()`       : Publish everything pending now
+
+    @note Timestamps are supplied by the caller in any monotonic unit; the
+         budgets use the same unit. The library never reads a clock.
+
+    @note Items are published with `cb_commit_write_ex()`, so the consumer side
+         is unchanged. Overwrite mode does not apply: a full ring is full.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_BATCH_H
+#define CB_BATCH_H
+
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* What caused a publish */
+#define CB_BATCH_BY_COUNT 1u        // `batch` items pending
+#define CB_BATCH_BY_TIME  2u        // Time budget expired
+#define CB_BATCH_BY_FLUSH 3u        // cb_batch_flush() or a full ring
+
+/* Batching producer */
+typedef struct {
+    cb *ring;                       // Underlying buffer
+    CbIndex pending;                // Items written past `in`, not yet published
+    CbIndex cached_out;             // Last consumer index seen
+    CbIndex batch;                  // Current count limit
+    CbIndex batch_min;              // Count limit bounds
+    CbIndex batch_max;
+    uint64_t budget;                // Current time budget
+    uint64_t budget_min;            // Time budget bounds
+    uint64_t budget_max;
+    uint64_t first_ts;              // Time the oldest pending item was written
+    unsigned last_reason;           // CB_BATCH_BY_* of the last publish (0 = none)
+} cb_batch_t;
+
+/* Initialization */
+cb_result_t cb_batch_init(cb_batch_t *b, cb *ring, CbIndex batch_min, CbIndex batch_max,
+                          uint64_t budget_min, uint64_t budget_max);
+
+/* Producer */
+cb_result_t cb_batch_insert(cb_batch_t *b, CbItem item, uint64_t now);
+cb_result_t cb_batch_insert_bulk(cb_batch_t *b, const CbItem *items, CbIndex count, uint64_t now,
+                                 CbIndex *inserted);
+cb_result_t cb_batch_tick(cb_batch_t *b, uint64_t now);
+cb_result_t cb_batch_flush(cb_batch_t *b);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_BATCH_H */
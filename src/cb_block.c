@@ -0,0 +1,227 @@
+/*
+    @file        cb_block.h / cb_block.c
+    @brief       Block ring: variable-length records grouped into fixed-size blocks
+    @details
+     - See cb_block.h for the block layout and publication scheme.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include "cb_block.h"
+#include "cb_internal.h"
+#include <string.h>  // For memcpy
+
+/* Records are 8-byte aligned within a block */
+#define CB_BLOCK_RECORD_ALIGN 8u
+
+static size_t cb_block_bytes(const cb_block_t *blk) {
+    return (size_t)blk->block_items * sizeof(CbItem);
+}
+
+static size_t cb_block_record_bytes(size_t length) {
+    size_t bytes = sizeof(cb_block_record_header_t) + length;
+    return (bytes + CB_BLOCK_RECORD_ALIGN - 1) & ~(size_t)(CB_BLOCK_RECORD_ALIGN - 1);
+}
+
+/* The open block always starts at the (unpublished) producer index */
+static uint8_t *cb_block_open_data(cb_block_t *blk) {
+    return (uint8_t *)&blk->ring.buf[CB_ATOMIC_LOAD(&blk->ring.in)];
+}
+
+/* Write the header of the open block and publish it with one index update */
+static void cb_block_close(cb_block_t *blk, uint32_t status) {
+    cb_block_header_t header;
+
+    header.seq = blk->seq;
+    header.num_records = blk->num_records;
+    header.length = (uint32_t)blk->fill;
+    header.status = status;
+    header.first_ts = blk->first_ts;
+    header.last_ts = blk->last_ts;
+    memcpy(cb_block_open_data(blk), &header, sizeof(header));
+
+    cb_commit_write_ex(&blk->ring, blk->block_items);
+
+    blk->seq++;
+    blk->num_records = 0;
+    blk->fill = 0;
+}
+
+cb_result_t cb_block_init(cb_block_t *blk, CbItem bufferStorage[], CbIndex bufferLength,
+                          CbIndex blockLength, uint64_t timeout) {
+    if (!blk || !bufferStorage) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    size_t block_bytes = (size_t)blockLength * sizeof(CbItem);
+    if (blockLength == 0 || block_bytes > UINT32_MAX ||
+        block_bytes < sizeof(cb_block_header_t) + cb_block_record_bytes(1)) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    /* Blocks must tile the storage so that none of them wraps */
+    if (bufferLength % blockLength != 0 || bufferLength / blockLength < 2) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    cb_result_t result = cb_init_ex(&blk->ring, bufferStorage, bufferLength);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    blk->block_items = blockLength;
+    blk->timeout = timeout;
+    blk->seq = 0;
+    blk->num_records = 0;
+    blk->fill = 0;
+    blk->first_ts = 0;
+    blk->last_ts = 0;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_block_write(cb_block_t *blk, const void *data, size_t length, uint64_t timestamp) {
+    if (!blk) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (!data && length > 0) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (blk->block_items == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    size_t record_bytes = cb_block_record_bytes(length);
+    if (record_bytes > cb_block_bytes(blk) - sizeof(cb_block_header_t)) {
+        CB_RETURN_ERROR(&blk->ring, CB_ERROR_INVALID_COUNT, "length");
+    }
+
+    /* Close the open block when it timed out or the record does not fit */
+    if (blk->fill > 0) {
+        if (blk->timeout > 0 && timestamp - blk->first_ts >= blk->timeout) {
+            cb_block_close(blk, CB_BLOCK_CLOSED_TIMEOUT);
+        } else if (blk->fill + record_bytes > cb_block_bytes(blk)) {
+            cb_block_close(blk, CB_BLOCK_CLOSED_FULL);
+        }
+    }
+
+    /* Open a new block in free space */
+    if (blk->fill == 0) {
+        CbIndex free_slots = cb_freeSpace(&blk->ring);
+        if (free_slots < blk->block_items) {
+            return CB_ERROR_BUFFER_FULL;
+        }
+        blk->fill = sizeof(cb_block_header_t);
+        blk->first_ts = timestamp;
+    }
+
+    cb_block_record_header_t record;
+    record.next_offset = (uint32_t)record_bytes;
+    record.length = (uint32_t)length;
+    record.timestamp = timestamp;
+
+    uint8_t *dst = cb_block_open_data(blk) + blk->fill;
+    memcpy(dst, &record, sizeof(record));
+    if (length > 0) {
+        memcpy(dst + sizeof(record), data, length);
+    }
+
+    blk->fill += record_bytes;
+    blk->num_records++;
+    blk->last_ts = timestamp;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_block_flush(cb_block_t *blk) {
+    if (!blk) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (blk->fill == 0) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    cb_block_close(blk, CB_BLOCK_CLOSED_FLUSH);
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_block_tick(cb_block_t *blk, uint64_t now) {
+    if (!blk) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (blk->fill == 0 || blk->timeout == 0 || now - blk->first_ts < blk->timeout) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    cb_block_close(blk, CB_BLOCK_CLOSED_TIMEOUT);
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_block_acquire(cb_block_t *blk, cb_block_desc_t *desc) {
+    if (!blk || !desc) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    cb_span_t spans[2];
+    CbIndex available = 0;
+    cb_result_t result = cb_get_read_spans_ex(&blk->ring, spans, &available);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    /* Blocks never wrap, so a closed block is always the start of the first span */
+    if (available < blk->block_items) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    desc->data = (const uint8_t *)spans[0].data;
+    memcpy(&desc->header, desc->data, sizeof(desc->header));
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_block_next(const cb_block_desc_t *desc, size_t *cursor, cb_block_record_t *record) {
+    if (!desc || !cursor || !record) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (*cursor < sizeof(cb_block_header_t)) {
+        *cursor = sizeof(cb_block_header_t);
+    }
+
+    if (*cursor >= desc->header.length) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    cb_block_record_header_t header;
+    memcpy(&header, desc->data + *cursor, sizeof(header));
+
+    if (header.next_offset < sizeof(header) ||
+        *cursor + header.next_offset > desc->header.length) {
+        return CB_ERROR_BUFFER_CORRUPTED;
+    }
+
+    record->data = desc->data + *cursor + sizeof(header);
+    record->length = header.length;
+    record->timestamp = header.timestamp;
+    *cursor += header.next_offset;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_block_release(cb_block_t *blk) {
+    if (!blk) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (cb_dataSize(&blk->ring) < blk->block_items) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    /* One index update retires every record of the block */
+    return cb_commit_read_ex(&blk->ring, blk->block_items);
+}
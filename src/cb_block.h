@@ -0,0 +1,117 @@
+/*
+    @file        cb_block.h / cb_block.c
+    @brief       Block ring: variable-length records grouped into fixed-size blocks
+    @details
+     - Modelled on the TPACKET_V3 capture ring. The ring storage is split into
+       equal blocks; the producer appends records to the open block and the
+       consumer retires whole blocks.
+     - Each block starts with a header (sequence number, record count, bytes
+       used, first/last record timestamps, close reason). Each record carries
+       its length and timestamp.
+     - The producer publishes `in` once per block and the consumer publishes
+       `out` once per block, instead of once per record.
+     - During low-rate periods a partly filled block is closed once it has
+       been open for `timeout` time units (`cb_block_tick()`), bounding the
+       latency seen by the consumer.
+
+     Public API:
+       - `cb_block_init()`    : Initialize a block ring over static storage
+       - `cb_block_write()`   : Append a record to the open block (producer)
+       - `cb_block_flush()`   : Close the open block now (producer)
+       - `cb_block_tick()`    : Close the open block if its timeout expired (producer)
+       - `cb_block_acquire()` : Get the oldest closed block (consumer)
+       - `cb_block_next()`    : Iterate the records of an acquired block
+       - `cb_block_release()` : Retire the acquired block (consumer)
+
+    @note Timestamps are supplied by the caller in any monotonic unit; the
+         timeout uses the same unit. The library never reads a clock.
+
+    @note The storage length must be a multiple of the block length. As with
+         the core buffer one slot stays empty, so one block is never used:
+         a ring of N blocks holds at most N - 1 blocks, open one included.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_BLOCK_H
+#define CB_BLOCK_H
+
+#include <stddef.h>
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Reasons a block was closed */
+#define CB_BLOCK_CLOSED_FULL    1u  // Next record did not fit
+#define CB_BLOCK_CLOSED_TIMEOUT 2u  // Open longer than the timeout
+#define CB_BLOCK_CLOSED_FLUSH   3u  // Closed by cb_block_flush()
+
+/* Block header, stored at the start of every block */
+typedef struct {
+    uint32_t seq;                   // Block sequence number
+    uint32_t num_records;           // Records in the block
+    uint32_t length;                // Bytes used, header included
+    uint32_t status;                // CB_BLOCK_CLOSED_* reason
+    uint64_t first_ts;              // Timestamp of the first record
+    uint64_t last_ts;               // Timestamp of the last record
+} cb_block_header_t;
+
+/* Record header, stored before every payload */
+typedef struct {
+    uint32_t next_offset;           // Offset of the next record from this header
+    uint32_t length;                // Payload length
+    uint64_t timestamp;             // Caller-supplied timestamp
+} cb_block_record_header_t;
+
+/* Acquired block */
+typedef struct {
+    const uint8_t *data;            // Start of the block (header included)
+    cb_block_header_t header;       // Copy of the block header
+} cb_block_desc_t;
+
+/* Record returned by iteration */
+typedef struct {
+    const void *data;               // Payload, in place
+    uint32_t length;                // Payload length
+    uint64_t timestamp;             // Record timestamp
+} cb_block_record_t;
+
+/* Block ring */
+typedef struct {
+    cb ring;                        // Underlying buffer, advanced per block
+    CbIndex block_items;            // Items per block
+    uint64_t timeout;               // Close a non-empty block after this long (0 = never)
+
+    /* Producer state (open block) */
+    uint32_t seq;                   // Sequence number of the open block
+    uint32_t num_records;           // Records in the open block
+    size_t fill;                    // Bytes used in the open block (0 = none open)
+    uint64_t first_ts;              // First record timestamp in the open block
+    uint64_t last_ts;               // Last record timestamp in the open block
+} cb_block_t;
+
+/* Initialization */
+cb_result_t cb_block_init(cb_block_t *blk, CbItem bufferStorage[], CbIndex bufferLength,
+                          CbIndex blockLength, uint64_t timeout);
+
+/* Producer */
+cb_result_t cb_block_write(cb_block_t *blk, const void *data, size_t length, uint64_t timestamp);
+cb_result_t cb_block_flush(cb_block_t *blk);
+cb_result_t cb_block_tick(cb_block_t *blk, uint64_t now);
+
+/* Consumer */
+cb_result_t cb_block_acquire(cb_block_t *blk, cb_block_desc_t *desc);
+cb_result_t cb_block_next(const cb_block_desc_t *desc, size_t *cursor, cb_block_record_t *record);
+cb_result_t cb_block_release(cb_block_t *blk);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_BLOCK_H */
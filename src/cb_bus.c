@@ -0,0 +1,153 @@
+/*
+    @file        cb_bus.h / cb_bus.c
+    @brief       In-process publish/subscribe bus on top of record rings
+    @details
+     - See cb_bus.h for the delivery rules.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include <string.h>
+#include "cb_bus.h"
+#include "cb_record.h"
+
+cb_result_t cb_bus_init(cb_bus_t *bus) {
+    if (!bus) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    memset(bus, 0, sizeof(*bus));
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_bus_topic(cb_bus_t *bus, const char *name, cb_bus_topic_t **topic) {
+    if (!bus || !name || !topic) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    size_t length = strlen(name);
+    if (length == 0 || length >= CB_BUS_NAME_LENGTH) {
+        return CB_ERROR_INVALID_PARAMETER;
+    }
+
+    for (unsigned i = 0; i < bus->topic_count; i++) {
+        if (strcmp(bus->topics[i].name, name) == 0) {
+            *topic = &bus->topics[i];
+            return CB_SUCCESS;
+        }
+    }
+
+    if (bus->topic_count == CB_BUS_MAX_TOPICS) {
+        return CB_ERROR_BUFFER_FULL;
+    }
+
+    cb_bus_topic_t *t = &bus->topics[bus->topic_count++];
+    memset(t, 0, sizeof(*t));
+    memcpy(t->name, name, length + 1);
+    *topic = t;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_bus_subscribe(cb_bus_topic_t *topic, cb_bus_sub_t *sub, CbItem storage[], CbIndex length) {
+    if (!topic || !sub || !storage) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    /* The ring is re-initialized below; never while another topic writes to it */
+    if (sub->topic) {
+        return CB_ERROR_INVALID_PARAMETER;
+    }
+
+    if (topic->sub_count == CB_BUS_MAX_SUBSCRIBERS) {
+        return CB_ERROR_BUFFER_FULL;
+    }
+
+    cb_result_t result = cb_init_ex(&sub->ring, storage, length);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    memset(&sub->stats, 0, sizeof(sub->stats));
+    sub->topic = topic;
+    topic->subs[topic->sub_count++] = sub;
+    topic->stats.subscribers = topic->sub_count;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_bus_unsubscribe(cb_bus_topic_t *topic, cb_bus_sub_t *sub) {
+    if (!topic || !sub) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    for (unsigned i = 0; i < topic->sub_count; i++) {
+        if (topic->subs[i] == sub) {
+            topic->subs[i] = topic->subs[--topic->sub_count];
+            topic->subs[topic->sub_count] = NULL;
+            topic->stats.subscribers = topic->sub_count;
+            sub->topic = NULL;
+            return CB_SUCCESS;
+        }
+    }
+    return CB_ERROR_INVALID_PARAMETER;
+}
+
+cb_result_t cb_bus_publish(cb_bus_topic_t *topic, const void *data, size_t length, unsigned *delivered) {
+    if (!topic || (!data && length > 0)) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    unsigned count = 0;
+    topic->stats.published++;
+
+    for (unsigned i = 0; i < topic->sub_count; i++) {
+        cb_bus_sub_t *sub = topic->subs[i];
+        if (cb_record_write(&sub->ring, data, length) == CB_SUCCESS) {
+            sub->stats.delivered++;
+            count++;
+        } else {
+            sub->stats.dropped++;
+        }
+    }
+
+    topic->stats.delivered += count;
+    topic->stats.dropped += topic->sub_count - count;
+
+    if (delivered) {
+        *delivered = count;
+    }
+    return (count == 0 && topic->sub_count > 0) ? CB_ERROR_BUFFER_FULL : CB_SUCCESS;
+}
+
+cb_result_t cb_bus_receive(cb_bus_sub_t *sub, void *data, size_t capacity, size_t *length) {
+    if (!sub) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    cb_result_t result = cb_record_read(&sub->ring, data, capacity, length);
+    if (result == CB_SUCCESS) {
+        sub->stats.received++;
+    }
+    return result;
+}
+
+cb_result_t cb_bus_topic_stats(const cb_bus_topic_t *topic, cb_bus_topic_stats_t *stats) {
+    if (!topic || !stats) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *stats = topic->stats;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_bus_sub_stats(const cb_bus_sub_t *sub, cb_bus_sub_stats_t *stats) {
+    if (!sub || !stats) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *stats = sub->stats;
+    return CB_SUCCESS;
+}
@@ -0,0 +1,126 @@
+/*
+    @file        cb_bus.h / cb_bus.c
+    @brief       In-process publish/subscribe bus on top of record rings
+    @details
+     - Topics are named once with `cb_bus_topic()`, which returns a handle.
+       Publishing goes through that handle: no hashing or string work on the
+       hot path.
+     - Every subscriber owns a ring over caller storage. A published message
+       is written to each subscriber's ring as a record (see cb_record.h),
+       each with one reservation and one `in` update, so a slow subscriber
+       never blocks the others.
+     - A subscriber belongs to one topic at a time; subscribing it again,
+       to the same or another topic, is rejected until it unsubscribes.
+     - A subscriber whose ring is full misses the message; the drop is
+       counted both per topic and per subscriber.
+     - Statistics: messages published, deliveries and drops per topic;
+       deliveries, drops and receptions per subscriber.
+
+     Public API:
+       - `cb_bus_init()`        : Initialize an empty bus
+       - `cb_bus_topic()`       : Find or create a topic by name, returning its handle
+       - `cb_bus_subscribe()`   : Attach a subscriber (with its ring storage) to a topic
+       - `cb_bus_unsubscribe()` : Detach a subscriber from a topic
+       - `cb_bus_publish()`     : Deliver a message to every subscriber of a topic
+       - `cb_bus_receive()`     : Take the oldest message of a subscriber
+       - `cb_bus_topic_stats()` : Per-topic counters
+       - `cb_bus_sub_stats()`   : Per-subscriber counters
+
+    @note Topics and subscriptions are set up before traffic starts:
+         `cb_bus_topic()`, `cb_bus_subscribe()` and `cb_bus_unsubscribe()` must
+         not run concurrently with `cb_bus_publish()` on the same topic.
+
+    @note Subscribers must be zero-initialized (static storage or `= {0}`)
+         before their first `cb_bus_subscribe()`.
+
+    @note Each topic has one publishing thread at a time and each subscriber
+         one receiving thread, which keeps every ring single-producer /
+         single-consumer. Counters are plain integers; read them from another
+         thread only as approximate values.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_BUS_H
+#define CB_BUS_H
+
+#include <stddef.h>
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CB_BUS_MAX_TOPICS
+#define CB_BUS_MAX_TOPICS 32        // Topics per bus
+#endif
+
+#ifndef CB_BUS_MAX_SUBSCRIBERS
+#define CB_BUS_MAX_SUBSCRIBERS 16   // Subscribers per topic
+#endif
+
+#ifndef CB_BUS_NAME_LENGTH
+#define CB_BUS_NAME_LENGTH 32       // Topic name buffer, terminator included
+#endif
+
+/* Per-subscriber counters */
+typedef struct {
+    uint64_t delivered;             // Messages written to the subscriber's ring
+    uint64_t dropped;               // Messages missed because the ring was full
+    uint64_t received;              // Messages taken with cb_bus_receive()
+} cb_bus_sub_stats_t;
+
+/* Per-topic counters */
+typedef struct {
+    uint64_t published;             // cb_bus_publish() calls
+    uint64_t delivered;             // Deliveries over all subscribers
+    uint64_t dropped;               // Drops over all subscribers
+    unsigned subscribers;           // Current subscriber count
+} cb_bus_topic_stats_t;
+
+struct cb_bus_topic_s;
+
+/* Subscriber; owned by the caller */
+typedef struct {
+    cb ring;                        // Messages for this subscriber (records)
+    cb_bus_sub_stats_t stats;       // Counters
+    struct cb_bus_topic_s *topic;   // Topic it is attached to, NULL when detached
+} cb_bus_sub_t;
+
+/* Topic; handles point into the bus */
+typedef struct cb_bus_topic_s {
+    char name[CB_BUS_NAME_LENGTH];  // Topic name
+    cb_bus_sub_t *subs[CB_BUS_MAX_SUBSCRIBERS]; // Subscribers
+    unsigned sub_count;             // Subscribers in use
+    cb_bus_topic_stats_t stats;     // Counters
+} cb_bus_topic_t;
+
+/* Bus */
+typedef struct {
+    cb_bus_topic_t topics[CB_BUS_MAX_TOPICS];
+    unsigned topic_count;
+} cb_bus_t;
+
+/* Setup */
+cb_result_t cb_bus_init(cb_bus_t *bus);
+cb_result_t cb_bus_topic(cb_bus_t *bus, const char *name, cb_bus_topic_t **topic);
+cb_result_t cb_bus_subscribe(cb_bus_topic_t *topic, cb_bus_sub_t *sub, CbItem storage[], CbIndex length);
+cb_result_t cb_bus_unsubscribe(cb_bus_topic_t *topic, cb_bus_sub_t *sub);
+
+/* Traffic */
+cb_result_t cb_bus_publish(cb_bus_topic_t *topic, const void *data, size_t length, unsigned *delivered);
+cb_result_t cb_bus_receive(cb_bus_sub_t *sub, void *data, size_t capacity, size_t *length);
+
+/* Statistics */
+cb_result_t cb_bus_topic_stats(const cb_bus_topic_t *topic, cb_bus_topic_stats_t *stats);
+cb_result_t cb_bus_sub_stats(const cb_bus_sub_t *sub, cb_bus_sub_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_BUS_H */
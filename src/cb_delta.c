@@ -0,0 +1,376 @@
+/*
+    @file        cb_delta.h / cb_delta.c
+    @brief       Compressed ring for slowly varying 32-bit samples
+    @details
+     - See cb_delta.h for the encoding and block layout.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include "cb_delta.h"
+#include "cb_internal.h"
+#include <string.h>  // For memcpy
+
+/* Longest LEB128 encoding of a 32-bit value */
+#define CB_DELTA_VARINT_MAX 5u
+
+/* Marks consumer state that refers to no block */
+#define CB_DELTA_NO_BLOCK UINT64_MAX
+
+/* Decode position inside a block */
+typedef struct {
+    uint64_t seq;                   // Next sample to decode
+    size_t offset;                  // Byte offset of its varint after the header
+    uint32_t value;                 // Previous sample (delta base)
+} cb_delta_cursor_t;
+
+static size_t cb_delta_block_bytes(const cb_delta_t *d) {
+    return (size_t)d->block_items * sizeof(CbItem);
+}
+
+static uint8_t *cb_delta_block_data(cb_delta_t *d, CbIndex pos) {
+    return (uint8_t *)&d->ring.buf[pos];
+}
+
+static void cb_delta_load_header(cb_delta_t *d, CbIndex pos, cb_delta_header_t *header) {
+    memcpy(header, cb_delta_block_data(d, pos), sizeof(*header));
+}
+
+static uint32_t cb_delta_zigzag(uint32_t delta) {
+    return (delta << 1) ^ (uint32_t)(0u - (delta >> 31));
+}
+
+static uint32_t cb_delta_unzigzag(uint32_t zz) {
+    return (zz >> 1) ^ (uint32_t)(0u - (zz & 1u));
+}
+
+static size_t cb_delta_varint_encode(uint32_t v, uint8_t out[CB_DELTA_VARINT_MAX]) {
+    size_t n = 0;
+
+    while (v >= 0x80u) {
+        out[n++] = (uint8_t)(v | 0x80u);
+        v >>= 7;
+    }
+    out[n++] = (uint8_t)v;
+    return n;
+}
+
+/* Decode the sample at the cursor and advance it; false on malformed data */
+static bool cb_delta_decode_next(const uint8_t *block, const cb_delta_header_t *header,
+                                 cb_delta_cursor_t *cur, uint32_t *value) {
+    if (cur->seq == header->first_seq) {
+        *value = header->first;
+        cur->offset = 0;
+    } else {
+        const uint8_t *p = block + sizeof(cb_delta_header_t);
+        uint32_t zz = 0;
+        unsigned shift = 0;
+        uint8_t byte;
+
+        do {
+            if (cur->offset >= header->bytes || shift > 28) {
+                return false;
+            }
+            byte = p[cur->offset++];
+            zz |= (uint32_t)(byte & 0x7Fu) << shift;
+            shift += 7;
+        } while (byte & 0x80u);
+
+        *value = cur->value + cb_delta_unzigzag(zz);
+    }
+
+    cur->value = *value;
+    cur->seq++;
+    return true;
+}
+
+static bool cb_delta_is_open(const cb_delta_t *d, CbIndex pos) {
+    return d->fill > 0 && pos == d->open_pos;
+}
+
+/*
+ * Bring the consumer state in line with the oldest block: adopt a block the
+ * cursor has not seen yet, skip samples lost to overwrite and release blocks
+ * that are fully consumed and closed.
+ */
+static cb_result_t cb_delta_head(cb_delta_t *d, CbIndex *pos, cb_delta_header_t *header) {
+    for (;;) {
+        if (cb_dataSize(&d->ring) < d->block_items) {
+            return CB_ERROR_BUFFER_EMPTY;
+        }
+
+        *pos = CB_ATOMIC_LOAD(&d->ring.out);
+        cb_delta_load_header(d, *pos, header);
+
+        if (header->first_seq != d->read_block) {
+            if (d->read_seq < header->first_seq) {
+                d->read_seq = header->first_seq;
+            }
+            d->read_block = header->first_seq;
+            d->read_offset = 0;
+        }
+
+        if (d->read_seq < header->first_seq + header->count) {
+            return CB_SUCCESS;
+        }
+
+        if (cb_delta_is_open(d, *pos)) {
+            return CB_ERROR_BUFFER_EMPTY;
+        }
+
+        cb_commit_read_ex(&d->ring, d->block_items);
+        d->read_block = CB_DELTA_NO_BLOCK;
+    }
+}
+
+cb_result_t cb_delta_init(cb_delta_t *d, CbItem bufferStorage[], CbIndex bufferLength, CbIndex blockLength) {
+    if (!d || !bufferStorage) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    size_t block_bytes = (size_t)blockLength * sizeof(CbItem);
+    if (blockLength == 0 || block_bytes > UINT32_MAX ||
+        block_bytes < sizeof(cb_delta_header_t) + CB_DELTA_VARINT_MAX) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    /* Blocks must tile the storage so that none of them wraps */
+    if (bufferLength % blockLength != 0 || bufferLength / blockLength < 2) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    cb_result_t result = cb_init_ex(&d->ring, bufferStorage, bufferLength);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    d->block_items = blockLength;
+    d->next_seq = 0;
+    d->last = 0;
+    d->fill = 0;
+    d->open_pos = 0;
+    d->read_seq = 0;
+    d->read_block = CB_DELTA_NO_BLOCK;
+    d->read_offset = 0;
+    d->read_value = 0;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_delta_push(cb_delta_t *d, uint32_t value) {
+    if (!d) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (d->block_items == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    uint8_t encoded[CB_DELTA_VARINT_MAX];
+    size_t n = cb_delta_varint_encode(cb_delta_zigzag(value - d->last), encoded);
+
+    /* Close the open block when the varint does not fit */
+    if (d->fill > 0 && d->fill + n > cb_delta_block_bytes(d)) {
+        d->fill = 0;
+    }
+
+    if (d->fill == 0) {
+        if (cb_freeSpace(&d->ring) < d->block_items) {
+            if (!cb_get_overwrite(&d->ring)) {
+                return CB_ERROR_BUFFER_FULL;
+            }
+            /* Drop the oldest block; the consumer resyncs on its next call */
+            cb_commit_read_ex(&d->ring, d->block_items);
+        }
+
+        /* A new block starts with the raw sample, so it decodes on its own */
+        cb_delta_header_t header;
+        header.first_seq = d->next_seq;
+        header.first = value;
+        header.count = 1;
+        header.bytes = 0;
+        header.reserved = 0;
+
+        d->open_pos = CB_ATOMIC_LOAD(&d->ring.in);
+        memcpy(cb_delta_block_data(d, d->open_pos), &header, sizeof(header));
+        cb_commit_write_ex(&d->ring, d->block_items);
+        d->fill = sizeof(header);
+    } else {
+        uint8_t *block = cb_delta_block_data(d, d->open_pos);
+        uint32_t count;
+        uint32_t bytes = (uint32_t)(d->fill + n - sizeof(cb_delta_header_t));
+
+        memcpy(block + d->fill, encoded, n);
+        memcpy(&count, block + offsetof(cb_delta_header_t, count), sizeof(count));
+        count++;
+        memcpy(block + offsetof(cb_delta_header_t, count), &count, sizeof(count));
+        memcpy(block + offsetof(cb_delta_header_t, bytes), &bytes, sizeof(bytes));
+        d->fill += n;
+    }
+
+    d->last = value;
+    d->next_seq++;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_delta_peek(cb_delta_t *d, uint32_t *value) {
+    if (!d || !value) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    CbIndex pos;
+    cb_delta_header_t header;
+    cb_result_t result = cb_delta_head(d, &pos, &header);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    cb_delta_cursor_t cur = { d->read_seq, d->read_offset, d->read_value };
+    if (!cb_delta_decode_next(cb_delta_block_data(d, pos), &header, &cur, value)) {
+        return CB_ERROR_BUFFER_CORRUPTED;
+    }
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_delta_pop(cb_delta_t *d, uint32_t *value) {
+    if (!d || !value) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    CbIndex pos;
+    cb_delta_header_t header;
+    cb_result_t result = cb_delta_head(d, &pos, &header);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    cb_delta_cursor_t cur = { d->read_seq, d->read_offset, d->read_value };
+    if (!cb_delta_decode_next(cb_delta_block_data(d, pos), &header, &cur, value)) {
+        return CB_ERROR_BUFFER_CORRUPTED;
+    }
+
+    d->read_seq = cur.seq;
+    d->read_offset = cur.offset;
+    d->read_value = cur.value;
+
+    /* Release a drained block right away unless the producer still fills it */
+    if (d->read_seq == header.first_seq + header.count && !cb_delta_is_open(d, pos)) {
+        cb_commit_read_ex(&d->ring, d->block_items);
+        d->read_block = CB_DELTA_NO_BLOCK;
+    }
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_delta_get(cb_delta_t *d, uint64_t index, uint32_t *value) {
+    if (!d || !value) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    CbIndex pos;
+    cb_delta_header_t header;
+    cb_result_t result = cb_delta_head(d, &pos, &header);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    if (index >= d->next_seq - d->read_seq) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    uint64_t target = d->read_seq + index;
+    cb_delta_cursor_t cur = { d->read_seq, d->read_offset, d->read_value };
+
+    /* Binary search the block headers for the last block starting at or before target */
+    CbIndex out = pos;
+    CbIndex lo = 0;
+    CbIndex hi = cb_dataSize(&d->ring) / d->block_items - 1;
+    while (lo < hi) {
+        CbIndex mid = lo + (hi - lo + 1) / 2;
+        cb_delta_header_t probe;
+        cb_delta_load_header(d, cb_internal_advance(out, mid * d->block_items, d->ring.size), &probe);
+        if (probe.first_seq <= target) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+
+    if (lo > 0) {
+        pos = cb_internal_advance(out, lo * d->block_items, d->ring.size);
+        cb_delta_load_header(d, pos, &header);
+        cur.seq = header.first_seq;
+        cur.offset = 0;
+        cur.value = 0;
+    }
+
+    const uint8_t *block = cb_delta_block_data(d, pos);
+    do {
+        if (!cb_delta_decode_next(block, &header, &cur, value)) {
+            return CB_ERROR_BUFFER_CORRUPTED;
+        }
+    } while (cur.seq <= target);
+
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_delta_skip(cb_delta_t *d, uint64_t count) {
+    if (!d) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (count > cb_delta_count(d)) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    uint64_t target = d->read_seq + count;
+
+    while (d->read_seq < target) {
+        CbIndex pos;
+        cb_delta_header_t header;
+        cb_result_t result = cb_delta_head(d, &pos, &header);
+        if (result != CB_SUCCESS) {
+            return result;
+        }
+
+        /* Whole closed blocks are dropped without decoding */
+        uint64_t end = header.first_seq + header.count;
+        if (target >= end && !cb_delta_is_open(d, pos)) {
+            cb_commit_read_ex(&d->ring, d->block_items);
+            d->read_seq = end;
+            d->read_block = CB_DELTA_NO_BLOCK;
+            continue;
+        }
+
+        cb_delta_cursor_t cur = { d->read_seq, d->read_offset, d->read_value };
+        const uint8_t *block = cb_delta_block_data(d, pos);
+        uint32_t value;
+        while (cur.seq < target) {
+            if (!cb_delta_decode_next(block, &header, &cur, &value)) {
+                return CB_ERROR_BUFFER_CORRUPTED;
+            }
+        }
+
+        d->read_seq = cur.seq;
+        d->read_offset = cur.offset;
+        d->read_value = cur.value;
+    }
+
+    return CB_SUCCESS;
+}
+
+uint64_t cb_delta_count(cb_delta_t *d) {
+    if (!d) {
+        return 0;
+    }
+
+    CbIndex pos;
+    cb_delta_header_t header;
+    if (cb_delta_head(d, &pos, &header) != CB_SUCCESS) {
+        return 0;
+    }
+
+    return d->next_seq - d->read_seq;
+}
@@ -0,0 +1,91 @@
+/*
+    @file        cb_delta.h / cb_delta.c
+    @brief       Compressed ring for slowly varying 32-bit samples
+    @details
+     - Samples are delta encoded, zigzag mapped and stored as LEB128 varints,
+       so a change of +/-63 takes one byte instead of four.
+     - The ring storage is split into equal blocks. Each block starts with a
+       header holding the sequence number and raw value of its first sample,
+       so every block decodes on its own.
+     - Push and pop are O(1) amortized. Random access and skips binary search
+       the block headers and decode inside a single block only.
+     - When the underlying ring has overwrite enabled (`cb_set_overwrite()`),
+       a push into a full ring drops the oldest block.
+
+     Public API:
+       - `cb_delta_init()`  : Initialize a compressed ring over static storage
+       - `cb_delta_push()`  : Append a sample
+       - `cb_delta_pop()`   : Remove the oldest sample
+       - `cb_delta_peek()`  : Read the oldest sample without removing it
+       - `cb_delta_get()`   : Read the sample at an offset from the oldest
+       - `cb_delta_skip()`  : Discard the oldest N samples
+       - `cb_delta_count()` : Number of stored samples
+
+    @note Not thread-safe: producer and consumer calls must be serialized by
+         the caller. The open block is visible to the consumer as it fills.
+
+    @note The storage length must be a multiple of the block length. A ring
+         of N blocks holds at most N - 1 blocks, open one included.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_DELTA_H
+#define CB_DELTA_H
+
+#include <stddef.h>
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Block header, stored at the start of every block */
+typedef struct {
+    uint64_t first_seq;             // Sequence number of the first sample
+    uint32_t first;                 // First sample, stored raw
+    uint32_t count;                 // Samples in the block
+    uint32_t bytes;                 // Encoded bytes after the header
+    uint32_t reserved;              // Keeps the header a multiple of 8 bytes
+} cb_delta_header_t;
+
+/* Compressed sample ring */
+typedef struct {
+    cb ring;                        // Underlying buffer, advanced per block
+    CbIndex block_items;            // Items per block
+
+    /* Producer state */
+    uint64_t next_seq;              // Sequence number of the next pushed sample
+    uint32_t last;                  // Last pushed sample (delta base)
+    size_t fill;                    // Bytes used in the open block (0 = none open)
+    CbIndex open_pos;               // Item position of the open block
+
+    /* Consumer state */
+    uint64_t read_seq;              // Sequence number of the next popped sample
+    uint64_t read_block;            // first_seq of the block read_offset refers to
+    size_t read_offset;             // Byte offset of the next varint in that block
+    uint32_t read_value;            // Last popped sample (delta base)
+} cb_delta_t;
+
+/* Initialization */
+cb_result_t cb_delta_init(cb_delta_t *d, CbItem bufferStorage[], CbIndex bufferLength, CbIndex blockLength);
+
+/* Producer */
+cb_result_t cb_delta_push(cb_delta_t *d, uint32_t value);
+
+/* Consumer */
+cb_result_t cb_delta_pop(cb_delta_t *d, uint32_t *value);
+cb_result_t cb_delta_peek(cb_delta_t *d, uint32_t *value);
+cb_result_t cb_delta_get(cb_delta_t *d, uint64_t index, uint32_t *value);
+cb_result_t cb_delta_skip(cb_delta_t *d, uint64_t count);
+uint64_t cb_delta_count(cb_delta_t *d);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_DELTA_H */
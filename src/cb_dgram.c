@@ -0,0 +1,189 @@
+/*
+    @file        cb_dgram.h / cb_dgram.c
+    @brief       Batched datagram I/O between record rings and sockets (Linux)
+    @details
+     - See cb_dgram.h for the batching scheme.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // For sendmmsg/recvmmsg
+#endif
+
+#include "cb_dgram.h"
+#include "cb_internal.h"
+#include <errno.h>
+#include <string.h>  // For memset
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+cb_result_t cb_dgram_send(cb *cb_ptr, int sock_fd, unsigned max_records, unsigned *sent) {
+    if (!cb_ptr || !sent) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *sent = 0;
+
+    if (cb_ptr->size == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    if (max_records == 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    if (max_records > CB_DGRAM_MAX_BATCH) {
+        max_records = CB_DGRAM_MAX_BATCH;
+    }
+
+    struct mmsghdr msgs[CB_DGRAM_MAX_BATCH];
+    struct iovec iov[CB_DGRAM_MAX_BATCH][2];
+    CbIndex release[CB_DGRAM_MAX_BATCH];
+    unsigned count = 0;
+    CbIndex offset = 0;
+    cb_record_view_t view;
+    cb_result_t result = CB_SUCCESS;
+
+    memset(msgs, 0, sizeof(msgs));
+
+    /* Map stored records onto message iovecs, skipping filler */
+    while (count <= max_records) {
+        result = cb_record_view(cb_ptr, offset, &view);
+        if (result != CB_SUCCESS) {
+            break;
+        }
+
+        offset += view.items;
+        if (view.padding) {
+            /* Filler is released with the record it trails */
+            if (count > 0) {
+                release[count - 1] = offset;
+            }
+            continue;
+        }
+
+        if (count == max_records) {
+            /* Looked one record ahead only to collect trailing filler */
+            break;
+        }
+
+        size_t iov_count = 0;
+        for (int i = 0; i < 2; i++) {
+            if (view.length[i] > 0) {
+                iov[count][iov_count].iov_base = view.data[i];
+                iov[count][iov_count].iov_len = view.length[i];
+                iov_count++;
+            }
+        }
+
+        msgs[count].msg_hdr.msg_iov = iov[count];
+        msgs[count].msg_hdr.msg_iovlen = iov_count;
+        release[count] = offset;
+        count++;
+    }
+
+    if (count == 0) {
+        return (result == CB_SUCCESS) ? CB_ERROR_BUFFER_EMPTY : result;
+    }
+
+    int n;
+    do {
+        n = sendmmsg(sock_fd, msgs, count, MSG_DONTWAIT);
+    } while (n < 0 && errno == EINTR);
+
+    if (n < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) {
+            return CB_ERROR_BUFFER_FULL;
+        }
+        CB_RETURN_ERROR(cb_ptr, CB_ERROR_IO, "sock_fd");
+    }
+
+    if (n > 0) {
+        /* Release every sent record (and its filler) at once */
+        cb_commit_read_ex(cb_ptr, release[n - 1]);
+    }
+
+    *sent = (unsigned)n;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_dgram_recv(cb *cb_ptr, int sock_fd, unsigned max_records, size_t max_length, unsigned *received) {
+    if (!cb_ptr || !received) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *received = 0;
+
+    if (cb_ptr->size == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    if (max_records == 0 || max_length == 0 || max_length > CB_RECORD_MAX_LENGTH) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    if (max_records > CB_DGRAM_MAX_BATCH) {
+        max_records = CB_DGRAM_MAX_BATCH;
+    }
+
+    struct mmsghdr msgs[CB_DGRAM_MAX_BATCH];
+    struct iovec iov[CB_DGRAM_MAX_BATCH][2];
+    CbIndex slot = cb_record_items(max_length);
+    unsigned count = 0;
+    cb_record_view_t view;
+
+    memset(msgs, 0, sizeof(msgs));
+
+    /* Point each message at a maximum-size record slot in free space */
+    while (count < max_records) {
+        if (cb_record_prepare(cb_ptr, (CbIndex)count * slot, max_length, &view) != CB_SUCCESS) {
+            break;
+        }
+
+        size_t iov_count = 0;
+        for (int i = 0; i < 2; i++) {
+            if (view.length[i] > 0) {
+                iov[count][iov_count].iov_base = view.data[i];
+                iov[count][iov_count].iov_len = view.length[i];
+                iov_count++;
+            }
+        }
+
+        msgs[count].msg_hdr.msg_iov = iov[count];
+        msgs[count].msg_hdr.msg_iovlen = iov_count;
+        count++;
+    }
+
+    if (count == 0) {
+        return CB_ERROR_BUFFER_FULL;
+    }
+
+    int n;
+    do {
+        n = recvmmsg(sock_fd, msgs, count, MSG_DONTWAIT, NULL);
+    } while (n < 0 && errno == EINTR);
+
+    if (n < 0) {
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return CB_ERROR_BUFFER_EMPTY;
+        }
+        CB_RETURN_ERROR(cb_ptr, CB_ERROR_IO, "sock_fd");
+    }
+
+    for (int i = 0; i < n; i++) {
+        cb_record_finish(cb_ptr, (CbIndex)i * slot, msgs[i].msg_len, max_length);
+    }
+
+    if (n > 0) {
+        /* Publish every received datagram at once */
+        cb_commit_write_ex(cb_ptr, (CbIndex)n * slot);
+    }
+
+    *received = (unsigned)n;
+    return CB_SUCCESS;
+}
@@ -0,0 +1,54 @@
+/*
+    @file        cb_dgram.h / cb_dgram.c
+    @brief       Batched datagram I/O between record rings and sockets (Linux)
+    @details
+     - `cb_dgram_send()` maps up to N stored records (see cb_record.h) onto the
+       `iovec`s of a `sendmmsg` call. Payloads are sent straight from ring
+       storage and all sent records are released with one index update.
+     - `cb_dgram_recv()` reserves N maximum-size record slots in the free space,
+       points the `iovec`s of a `recvmmsg` call at them and publishes every
+       received datagram with one index update. Unused slot tails become filler
+       records, which readers skip.
+     - One syscall moves a whole batch instead of one `sendto`/`recvfrom` per
+       record.
+
+     Public API:
+       - `cb_dgram_send()` : Send up to N records with one `sendmmsg`
+       - `cb_dgram_recv()` : Receive up to N datagrams with one `recvmmsg`
+
+    @note Sockets must be connected (e.g. `socketpair`, or `connect` on a
+         UNIX datagram socket). Calls never block; `CB_ERROR_BUFFER_FULL`
+         from `cb_dgram_send()` means the socket queue is full.
+
+    @note Datagrams longer than `max_length` are truncated to `max_length`.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_DGRAM_H
+#define CB_DGRAM_H
+
+#include <stddef.h>
+#include "cb.h"
+#include "cb_record.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CB_DGRAM_MAX_BATCH
+#define CB_DGRAM_MAX_BATCH 64       // Messages per syscall
+#endif
+
+cb_result_t cb_dgram_send(cb *cb_ptr, int sock_fd, unsigned max_records, unsigned *sent);
+cb_result_t cb_dgram_recv(cb *cb_ptr, int sock_fd, unsigned max_records, size_t max_length, unsigned *received);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_DGRAM_H */
@@ -0,0 +1,221 @@
+/*
+    @file        cb_env.h / cb_env.c
+    @brief       Multi-resolution min/max envelope pyramid over a history ring
+    @details
+     - See cb_env.h for the pyramid layout.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include "cb_env.h"
+#include "cb_internal.h"
+
+static unsigned cb_env_shift(const cb_env_t *env, unsigned level) {
+    return env->base_shift + level * env->factor_shift;
+}
+
+static cb_env_entry_t *cb_env_entry(cb_env_t *env, unsigned level, uint64_t block) {
+    return &env->entries[env->offset[level] + (size_t)(block % env->count[level])];
+}
+
+static void cb_env_merge(cb_env_entry_t *acc, bool *has, CbItem min, CbItem max) {
+    if (!*has) {
+        acc->min = min;
+        acc->max = max;
+        *has = true;
+        return;
+    }
+    if (CB_ENV_LESS(min, acc->min)) {
+        acc->min = min;
+    }
+    if (CB_ENV_LESS(acc->max, max)) {
+        acc->max = max;
+    }
+}
+
+/* Fold the item with absolute number seq into every level */
+static void cb_env_update(cb_env_t *env, uint64_t seq, CbItem item) {
+    for (unsigned level = 0; level < env->levels; level++) {
+        unsigned shift = cb_env_shift(env, level);
+        cb_env_entry_t *e = cb_env_entry(env, level, seq >> shift);
+
+        if ((seq & (((uint64_t)1 << shift) - 1)) == 0) {
+            /* First item of a block replaces whatever the slot held */
+            e->min = item;
+            e->max = item;
+        } else {
+            bool has = true;
+            cb_env_merge(e, &has, item, item);
+        }
+    }
+}
+
+/* Oldest stored item as an absolute number */
+static uint64_t cb_env_oldest(const cb_env_t *env) {
+    return env->next_seq - cb_dataSize(env->ring);
+}
+
+/*
+ * Combine [a, b) using whole blocks of `level`, and finer levels or raw items
+ * for the parts that do not fill a block. The newest block may be partial;
+ * it is used when the range ends at the newest item.
+ */
+static cb_result_t cb_env_cover(cb_env_t *env, int level, uint64_t a, uint64_t b,
+                                uint64_t oldest, cb_env_entry_t *acc, bool *has) {
+    if (a >= b) {
+        return CB_SUCCESS;
+    }
+
+    if (level < 0) {
+        for (uint64_t s = a; s < b; s++) {
+            CbItem item;
+            cb_result_t result = cb_peek_ex(env->ring, (CbIndex)(s - oldest), &item);
+            if (result != CB_SUCCESS) {
+                return result;
+            }
+            cb_env_merge(acc, has, item, item);
+        }
+        return CB_SUCCESS;
+    }
+
+    unsigned shift = cb_env_shift(env, (unsigned)level);
+    uint64_t size = (uint64_t)1 << shift;
+    uint64_t first = (a + size - 1) >> shift << shift;
+    uint64_t last = (b == env->next_seq) ? ((b + size - 1) >> shift << shift) : (b >> shift << shift);
+
+    if (first >= last || first >= b) {
+        return cb_env_cover(env, level - 1, a, b, oldest, acc, has);
+    }
+
+    cb_result_t result = cb_env_cover(env, level - 1, a, first, oldest, acc, has);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    for (uint64_t start = first; start < last; start += size) {
+        const cb_env_entry_t *e = cb_env_entry(env, (unsigned)level, start >> shift);
+        cb_env_merge(acc, has, e->min, e->max);
+    }
+
+    return cb_env_cover(env, level - 1, (last < b) ? last : b, b, oldest, acc, has);
+}
+
+size_t cb_env_entries(CbIndex bufferLength, unsigned base_shift, unsigned factor_shift, unsigned levels) {
+    size_t total = 0;
+
+    for (unsigned level = 0; level < levels; level++) {
+        unsigned shift = base_shift + level * factor_shift;
+        /* Blocks overlapping the stored items, plus partial ones at both ends */
+        total += (shift < 8 * sizeof(CbIndex) ? (size_t)(bufferLength >> shift) : 0) + 2;
+    }
+    return total;
+}
+
+cb_result_t cb_env_init(cb_env_t *env, cb *ring, cb_env_entry_t *entries, size_t entry_count,
+                        unsigned base_shift, unsigned factor_shift, unsigned levels) {
+    if (!env || !ring || !entries) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (ring->size == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    if (levels == 0 || levels > CB_ENV_MAX_LEVELS || factor_shift == 0 ||
+        base_shift + (levels - 1) * factor_shift >= 48) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    if (entry_count < cb_env_entries(ring->size, base_shift, factor_shift, levels)) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    env->ring = ring;
+    env->entries = entries;
+    env->levels = levels;
+    env->base_shift = base_shift;
+    env->factor_shift = factor_shift;
+
+    size_t offset = 0;
+    for (unsigned level = 0; level < levels; level++) {
+        unsigned shift = cb_env_shift(env, level);
+        env->offset[level] = offset;
+        env->count[level] = (shift < 8 * sizeof(CbIndex) ? (size_t)(ring->size >> shift) : 0) + 2;
+        offset += env->count[level];
+    }
+
+    /* Items already stored are numbered from 0 */
+    CbIndex stored = cb_dataSize(ring);
+    env->next_seq = 0;
+    for (CbIndex i = 0; i < stored; i++) {
+        CbItem item;
+        cb_peek_ex(ring, i, &item);
+        cb_env_update(env, env->next_seq++, item);
+    }
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_env_insert(cb_env_t *env, CbItem item) {
+    if (!env) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    cb_result_t result = cb_insert_ex(env->ring, item);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    cb_env_update(env, env->next_seq++, item);
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_env_insert_bulk(cb_env_t *env, const CbItem *items, CbIndex count, CbIndex *inserted) {
+    if (!env) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    cb_result_t result = cb_insert_bulk_ex(env->ring, items, count, inserted);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    for (CbIndex i = 0; i < *inserted; i++) {
+        cb_env_update(env, env->next_seq++, items[i]);
+    }
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_env_query(cb_env_t *env, CbIndex offset, CbIndex count,
+                         unsigned pixels, cb_env_entry_t *out) {
+    if (!env || !out) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (pixels == 0 || count < pixels) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    CbIndex stored = cb_dataSize(env->ring);
+    if (offset > stored || count > stored - offset) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    uint64_t oldest = cb_env_oldest(env);
+    uint64_t a = oldest + offset;
+
+    for (unsigned p = 0; p < pixels; p++) {
+        uint64_t lo = a + (uint64_t)count * p / pixels;
+        uint64_t hi = a + (uint64_t)count * (p + 1) / pixels;
+        bool has = false;
+
+        cb_result_t result = cb_env_cover(env, (int)env->levels - 1, lo, hi, oldest, &out[p], &has);
+        if (result != CB_SUCCESS) {
+            return result;
+        }
+    }
+    return CB_SUCCESS;
+}
@@ -0,0 +1,94 @@
+/*
+    @file        cb_env.h / cb_env.c
+    @brief       Multi-resolution min/max envelope pyramid over a history ring
+    @details
+     - Keeps a min/max pair per block of samples at several decimation
+       levels. Level 0 blocks hold `1 << base_shift` samples and every level
+       up is `1 << factor_shift` times coarser.
+     - The pyramid is updated on every insert in O(levels).
+     - `cb_env_query()` splits a range of the ring into N pixels and answers
+       each from the coarsest blocks that fit, descending to finer levels
+       and finally raw samples only at the pixel edges.
+     - A level keeps `(size >> shift) + 2` entries, indexed by block number
+       modulo that count; the first sample of a block resets its entry.
+       Queries only cover stored samples, the last `size` at most, and that
+       span never needs more entries than the level has. Overwrite eviction
+       and consumer removal therefore never produce stale results.
+
+     Public API:
+       - `cb_env_entries()`     : Number of pyramid entries needed for a ring
+       - `cb_env_init()`        : Attach a pyramid to a ring
+       - `cb_env_insert()`      : Insert one item and update the pyramid
+       - `cb_env_insert_bulk()` : Insert up to N items and update the pyramid
+       - `cb_env_query()`       : Min/max of a range, split into N pixels
+
+    @note Items must be inserted through `cb_env_insert*()` so the pyramid
+         sees them. Removing through the core API is fine.
+
+    @note Not thread-safe: inserts, removals and queries must be serialized
+         by the caller.
+
+    @note Items are compared with `CB_ENV_LESS(a, b)`, `(a) < (b)` by default;
+         define it for non-arithmetic `CB_ITEM_TYPE`s.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_ENV_H
+#define CB_ENV_H
+
+#include <stddef.h>
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CB_ENV_MAX_LEVELS
+#define CB_ENV_MAX_LEVELS 8         // Decimation levels per pyramid
+#endif
+
+#ifndef CB_ENV_LESS
+#define CB_ENV_LESS(a, b) ((a) < (b))
+#endif
+
+/* Envelope of one block or pixel */
+typedef struct {
+    CbItem min;                     // Smallest item
+    CbItem max;                     // Largest item
+} cb_env_entry_t;
+
+/* Envelope pyramid */
+typedef struct {
+    cb *ring;                       // History ring
+    cb_env_entry_t *entries;        // Entries of all levels
+    unsigned levels;                // Number of levels
+    unsigned base_shift;            // log2 of the level 0 block size
+    unsigned factor_shift;          // log2 of the size ratio between levels
+    size_t offset[CB_ENV_MAX_LEVELS];   // First entry of each level
+    size_t count[CB_ENV_MAX_LEVELS];    // Entries of each level
+    uint64_t next_seq;              // Absolute number of the next inserted item
+} cb_env_t;
+
+/* Sizing and initialization */
+size_t cb_env_entries(CbIndex bufferLength, unsigned base_shift, unsigned factor_shift, unsigned levels);
+cb_result_t cb_env_init(cb_env_t *env, cb *ring, cb_env_entry_t *entries, size_t entry_count,
+                        unsigned base_shift, unsigned factor_shift, unsigned levels);
+
+/* Producer */
+cb_result_t cb_env_insert(cb_env_t *env, CbItem item);
+cb_result_t cb_env_insert_bulk(cb_env_t *env, const CbItem *items, CbIndex count, CbIndex *inserted);
+
+/* Queries; offset counts from the oldest stored item */
+cb_result_t cb_env_query(cb_env_t *env, CbIndex offset, CbIndex count,
+                         unsigned pixels, cb_env_entry_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_ENV_H */
@@ -0,0 +1,277 @@
+/*
+    @file        cb_fir.h / cb_fir.c
+    @brief       Streaming FIR filter that uses the input ring as its delay line
+    @details
+     - See cb_fir.h for the delay line scheme.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include "cb_fir.h"
+#include "cb_internal.h"
+#include <string.h>  // For memcpy
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define CB_FIR_HAS_AVX2 1
+    #include <immintrin.h>
+#else
+    #define CB_FIR_HAS_AVX2 0
+#endif
+
+/* Round a Q15 accumulator back to a saturated sample */
+static int16_t cb_fir_q15_round(uint32_t acc) {
+    int32_t v = (int32_t)(acc + (1u << 14)) >> 15;
+    if (v > INT16_MAX) {
+        return INT16_MAX;
+    }
+    if (v < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return (int16_t)v;
+}
+
+/* y[j] = sum h[k] * x[j + k], with h in oldest-sample order */
+static void cb_fir_kernel_f32(const float *x, const float *h, unsigned taps, float *y, size_t n) {
+    for (size_t j = 0; j < n; j++) {
+        float acc = 0.0f;
+        for (unsigned k = 0; k < taps; k++) {
+            acc += h[k] * x[j + k];
+        }
+        y[j] = acc;
+    }
+}
+
+static void cb_fir_kernel_q15(const int16_t *x, const int16_t *h, unsigned taps, int16_t *y, size_t n) {
+    for (size_t j = 0; j < n; j++) {
+        uint32_t acc = 0;
+        for (unsigned k = 0; k < taps; k++) {
+            acc += (uint32_t)((int32_t)h[k] * (int32_t)x[j + k]);
+        }
+        y[j] = cb_fir_q15_round(acc);
+    }
+}
+
+#if CB_FIR_HAS_AVX2
+/* Eight outputs per step: broadcast one tap, multiply-add eight shifted inputs */
+__attribute__((target("avx2,fma")))
+static void cb_fir_kernel_f32_avx2(const float *x, const float *h, unsigned taps, float *y, size_t n) {
+    size_t j = 0;
+
+    for (; j + 8 <= n; j += 8) {
+        __m256 acc = _mm256_setzero_ps();
+        for (unsigned k = 0; k < taps; k++) {
+            acc = _mm256_fmadd_ps(_mm256_set1_ps(h[k]), _mm256_loadu_ps(x + j + k), acc);
+        }
+        _mm256_storeu_ps(y + j, acc);
+    }
+
+    cb_fir_kernel_f32(x + j, h, taps, y + j, n - j);
+}
+
+__attribute__((target("avx2,fma")))
+static void cb_fir_kernel_q15_avx2(const int16_t *x, const int16_t *h, unsigned taps, int16_t *y, size_t n) {
+    const __m256i round = _mm256_set1_epi32(1 << 14);
+    size_t j = 0;
+
+    for (; j + 8 <= n; j += 8) {
+        __m256i acc = _mm256_setzero_si256();
+        for (unsigned k = 0; k < taps; k++) {
+            __m256i xs = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(x + j + k)));
+            acc = _mm256_add_epi32(acc, _mm256_mullo_epi32(xs, _mm256_set1_epi32(h[k])));
+        }
+        acc = _mm256_srai_epi32(_mm256_add_epi32(acc, round), 15);
+
+        /* Saturate to 16 bits and gather the two 64-bit halves into the low lane */
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(acc, acc), 0x08);
+        _mm_storeu_si128((__m128i *)(y + j), _mm256_castsi256_si128(packed));
+    }
+
+    cb_fir_kernel_q15(x + j, h, taps, y + j, n - j);
+}
+
+static bool cb_fir_avx2(void) {
+    static int supported = -1;
+
+    if (supported < 0) {
+        __builtin_cpu_init();
+        supported = (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) ? 1 : 0;
+    }
+    return supported == 1;
+}
+#endif
+
+static void cb_fir_run(const cb_fir_t *f, const void *x, void *y, size_t n) {
+    if (f->format == CB_FIR_F32) {
+#if CB_FIR_HAS_AVX2
+        if (cb_fir_avx2()) {
+            cb_fir_kernel_f32_avx2((const float *)x, f->coeff_f32, f->taps, (float *)y, n);
+            return;
+        }
+#endif
+        cb_fir_kernel_f32((const float *)x, f->coeff_f32, f->taps, (float *)y, n);
+    } else {
+#if CB_FIR_HAS_AVX2
+        if (cb_fir_avx2()) {
+            cb_fir_kernel_q15_avx2((const int16_t *)x, f->coeff_q15, f->taps, (int16_t *)y, n);
+            return;
+        }
+#endif
+        cb_fir_kernel_q15((const int16_t *)x, f->coeff_q15, f->taps, (int16_t *)y, n);
+    }
+}
+
+cb_result_t cb_fir_init_f32(cb_fir_t *f, const float *taps, unsigned count) {
+    if (!f || !taps) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (count == 0 || count > CB_FIR_MAX_TAPS) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    if (sizeof(float) % sizeof(CbItem) != 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    f->format = CB_FIR_F32;
+    f->taps = count;
+    f->sample_size = sizeof(float);
+
+    /* Reverse so that the kernels walk taps and samples in the same direction */
+    for (unsigned k = 0; k < count; k++) {
+        f->coeff_f32[k] = taps[count - 1 - k];
+    }
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_fir_init_q15(cb_fir_t *f, const int16_t *taps, unsigned count) {
+    if (!f || !taps) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (count == 0 || count > CB_FIR_MAX_TAPS) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    if (sizeof(int16_t) % sizeof(CbItem) != 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    f->format = CB_FIR_Q15;
+    f->taps = count;
+    f->sample_size = sizeof(int16_t);
+
+    for (unsigned k = 0; k < count; k++) {
+        f->coeff_q15[k] = taps[count - 1 - k];
+    }
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_fir_process(cb_fir_t *f, cb *in, cb *out, CbIndex max_samples, CbIndex *produced) {
+    if (!f || !in || !out || !produced) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *produced = 0;
+
+    if (f->taps == 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    CbIndex per_sample = (CbIndex)(f->sample_size / sizeof(CbItem));
+    if (in->size == 0 || out->size == 0 || in->size % per_sample != 0 || out->size % per_sample != 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    if (max_samples == 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    /* Every output needs a full window of `taps` input samples */
+    CbIndex current_out = CB_ATOMIC_LOAD(&in->out);
+    CbIndex current_in = cb_internal_load_in(in);
+    CbIndex available = cb_internal_used(current_in, current_out, in->size) / per_sample;
+    if (available < f->taps) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    cb_span_t spans[2];
+    CbIndex writable = 0;
+    cb_result_t result = cb_get_write_spans_ex(out, spans, &writable);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    CbIndex n = available - (f->taps - 1);
+    if (n > max_samples) {
+        n = max_samples;
+    }
+    if (n > writable / per_sample) {
+        n = writable / per_sample;
+    }
+    if (n == 0) {
+        return CB_ERROR_BUFFER_FULL;
+    }
+
+    const uint8_t *base = (const uint8_t *)in->buf;
+    size_t ss = f->sample_size;
+    CbIndex ring_samples = in->size / per_sample;
+    CbIndex first = current_out / per_sample;
+    void *scratch = (f->format == CB_FIR_F32) ? (void *)f->scratch_f32 : (void *)f->scratch_q15;
+    CbIndex done = 0;
+    int span = 0;
+    CbIndex span_used = 0;
+
+    while (done < n) {
+        CbIndex start = first + done;
+        if (start >= ring_samples) {
+            start -= ring_samples;
+        }
+
+        const void *x;
+        CbIndex run;
+        if (start + f->taps <= ring_samples) {
+            /* Windows that do not cross the wrap point are read in place */
+            x = base + (size_t)start * ss;
+            run = ring_samples - start - f->taps + 1;
+        } else {
+            /* Join the tail and head of the storage for the straddling windows */
+            CbIndex before = ring_samples - start;
+            CbIndex after = available - done - before;
+            if (after > f->taps - 1) {
+                after = f->taps - 1;
+            }
+            memcpy(scratch, base + (size_t)start * ss, (size_t)before * ss);
+            memcpy((uint8_t *)scratch + (size_t)before * ss, base, (size_t)after * ss);
+            x = scratch;
+            run = before + after - f->taps + 1;
+        }
+
+        if (spans[span].count / per_sample == span_used) {
+            span++;
+            span_used = 0;
+        }
+
+        CbIndex room = spans[span].count / per_sample - span_used;
+        if (run > room) {
+            run = room;
+        }
+        if (run > n - done) {
+            run = n - done;
+        }
+
+        cb_fir_run(f, x, (uint8_t *)spans[span].data + (size_t)span_used * ss, run);
+        done += run;
+        span_used += run;
+    }
+
+    /* One publish for all outputs; keep the last taps - 1 inputs as the delay line */
+    cb_commit_write_ex(out, n * per_sample);
+    cb_commit_read_ex(in, n * per_sample);
+    *produced = n;
+    return CB_SUCCESS;
+}
@@ -0,0 +1,84 @@
+/*
+    @file        cb_fir.h / cb_fir.c
+    @brief       Streaming FIR filter that uses the input ring as its delay line
+    @details
+     - Input and output are ordinary `cb` buffers carrying raw samples
+       (`float` or Q15 `int16_t`). One sample spans
+       `sizeof(sample) / sizeof(CbItem)` items.
+     - The filter reads its taps straight from ring storage. After a call it
+       releases only the samples that are no longer needed, so the last
+       `taps - 1` input samples stay in the input ring as the delay line;
+       nothing is copied per output sample.
+     - Windows that straddle the wrap point are assembled in a small scratch
+       area of at most `2 * (taps - 1)` samples; all other windows are read
+       in place.
+     - Outputs are written into the write spans of the output ring and
+       published with one index update per call.
+     - x86 CPUs with AVX2 and FMA compute 8 outputs per step (run-time
+       check with GCC/Clang); otherwise a portable scalar kernel is used.
+
+     Public API:
+       - `cb_fir_init_f32()` : Initialize a float filter
+       - `cb_fir_init_q15()` : Initialize a Q15 fixed-point filter
+       - `cb_fir_process()`  : Filter all complete windows from one ring into another
+
+    @note The input ring keeps `taps - 1` samples after every call, so the
+         first output needs `taps` input samples and the usable input
+         capacity shrinks by `taps - 1` samples.
+
+    @note Q15 products are accumulated in 32 bits (wrapping) and rounded back
+         to Q15 with saturation, so keep sum(|taps|) * max|x| below 2^31.
+
+    @note Ring storage must be aligned for the sample type, and each ring size
+         must be a whole number of samples.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_FIR_H
+#define CB_FIR_H
+
+#include <stddef.h>
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CB_FIR_MAX_TAPS
+#define CB_FIR_MAX_TAPS 128         // Longest supported filter
+#endif
+
+/* Sample formats */
+typedef enum {
+    CB_FIR_F32,                     // 32-bit float samples and taps
+    CB_FIR_Q15                      // int16_t samples and Q15 taps
+} cb_fir_format_t;
+
+/* Filter state */
+typedef struct {
+    cb_fir_format_t format;         // Sample format
+    unsigned taps;                  // Number of taps
+    size_t sample_size;             // Bytes per sample
+    float coeff_f32[CB_FIR_MAX_TAPS];   // Taps, oldest-sample order
+    int16_t coeff_q15[CB_FIR_MAX_TAPS]; // Taps, oldest-sample order
+    float scratch_f32[2 * CB_FIR_MAX_TAPS];     // Windows across the wrap point
+    int16_t scratch_q15[2 * CB_FIR_MAX_TAPS];   // Windows across the wrap point
+} cb_fir_t;
+
+/* Initialization; taps[0] weights the newest sample */
+cb_result_t cb_fir_init_f32(cb_fir_t *f, const float *taps, unsigned count);
+cb_result_t cb_fir_init_q15(cb_fir_t *f, const int16_t *taps, unsigned count);
+
+/* Filtering */
+cb_result_t cb_fir_process(cb_fir_t *f, cb *in, cb *out, CbIndex max_samples, CbIndex *produced);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_FIR_H */
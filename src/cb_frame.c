@@ -0,0 +1,300 @@
+/*
+    @file        cb_frame.h / cb_frame.c
+    @brief       COBS / SLIP frame codecs working directly on ring storage
+    @details
+     - See cb_frame.h for the framing rules.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include <string.h>
+#include "cb_frame.h"
+#include "cb_internal.h"
+
+/* The two ring segments seen as one byte sequence */
+typedef struct {
+    uint8_t *seg[2];
+    size_t len[2];
+    size_t total;
+} cb_frame_view_t;
+
+static void cb_frame_view(cb_frame_view_t *v, const cb_span_t spans[2]) {
+    for (int i = 0; i < 2; i++) {
+        v->seg[i] = (uint8_t *)spans[i].data;
+        v->len[i] = spans[i].count;
+    }
+    v->total = v->len[0] + v->len[1];
+}
+
+static inline uint8_t *cb_frame_at(const cb_frame_view_t *v, size_t pos) {
+    return (pos < v->len[0]) ? &v->seg[0][pos] : &v->seg[1][pos - v->len[0]];
+}
+
+static uint8_t cb_frame_delimiter(cb_frame_codec_t codec) {
+    return (codec == CB_FRAME_SLIP) ? (uint8_t)CB_FRAME_SLIP_END : 0u;
+}
+
+/* Copy n bytes starting at pos, across the segment boundary if needed */
+static void cb_frame_copy(const cb_frame_view_t *v, size_t pos, uint8_t *dst, size_t n) {
+    if (pos < v->len[0]) {
+        size_t first = v->len[0] - pos;
+        if (first >= n) {
+            memcpy(dst, v->seg[0] + pos, n);
+            return;
+        }
+        memcpy(dst, v->seg[0] + pos, first);
+        dst += first;
+        n -= first;
+        pos = v->len[0];
+    }
+    memcpy(dst, v->seg[1] + (pos - v->len[0]), n);
+}
+
+/* Find [start, end) of the oldest complete frame; end indexes its delimiter */
+static bool cb_frame_locate(const cb_frame_view_t *v, uint8_t delim, size_t *start, size_t *end) {
+    size_t pos = 0;
+
+    /* Empty frames are skipped */
+    while (pos < v->total && *cb_frame_at(v, pos) == delim) {
+        pos++;
+    }
+    *start = pos;
+
+    for (int i = 0; i < 2; i++) {
+        size_t base = (i == 0) ? 0 : v->len[0];
+        if (pos >= base + v->len[i]) {
+            continue;
+        }
+        const uint8_t *from = v->seg[i] + (pos - base);
+        const uint8_t *hit = (const uint8_t *)memchr(from, delim, v->len[i] - (pos - base));
+        if (hit) {
+            *end = base + (size_t)(hit - v->seg[i]);
+            return true;
+        }
+        pos = base + v->len[i];
+    }
+    return false;
+}
+
+static cb_result_t cb_frame_decode_cobs(const cb_frame_view_t *v, size_t pos, size_t end,
+                                        uint8_t *dst, size_t capacity, size_t *length) {
+    size_t produced = 0;
+
+    while (pos < end) {
+        uint8_t code = *cb_frame_at(v, pos++);
+        size_t run = (size_t)code - 1;
+
+        if (run > end - pos) {
+            return CB_ERROR_BUFFER_CORRUPTED;
+        }
+        if (run > capacity - produced) {
+            return CB_ERROR_INVALID_SIZE;
+        }
+        cb_frame_copy(v, pos, dst + produced, run);
+        produced += run;
+        pos += run;
+
+        /* Every block but a full one and the last stands for a zero */
+        if (code != 0xFF && pos < end) {
+            if (produced == capacity) {
+                return CB_ERROR_INVALID_SIZE;
+            }
+            dst[produced++] = 0;
+        }
+    }
+
+    *length = produced;
+    return CB_SUCCESS;
+}
+
+static cb_result_t cb_frame_decode_slip(const cb_frame_view_t *v, size_t pos, size_t end,
+                                        uint8_t *dst, size_t capacity, size_t *length) {
+    size_t produced = 0;
+    bool escaped = false;
+
+    for (int i = 0; i < 2 && pos < end; i++) {
+        size_t base = (i == 0) ? 0 : v->len[0];
+        size_t stop = (end < base + v->len[i]) ? end : base + v->len[i];
+        if (pos >= stop) {
+            continue;
+        }
+
+        for (const uint8_t *p = v->seg[i] + (pos - base), *e = v->seg[i] + (stop - base); p < e; p++) {
+            uint8_t b = *p;
+            if (escaped) {
+                if (b == CB_FRAME_SLIP_ESC_END) {
+                    b = CB_FRAME_SLIP_END;
+                } else if (b == CB_FRAME_SLIP_ESC_ESC) {
+                    b = CB_FRAME_SLIP_ESC;
+                } else {
+                    return CB_ERROR_BUFFER_CORRUPTED;
+                }
+                escaped = false;
+            } else if (b == CB_FRAME_SLIP_ESC) {
+                escaped = true;
+                continue;
+            }
+            if (produced == capacity) {
+                return CB_ERROR_INVALID_SIZE;
+            }
+            dst[produced++] = b;
+        }
+        pos = stop;
+    }
+
+    if (escaped) {
+        return CB_ERROR_BUFFER_CORRUPTED;
+    }
+
+    *length = produced;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_frame_find(cb *cb_ptr, cb_frame_codec_t codec, CbIndex *length) {
+    if (!cb_ptr || !length) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *length = 0;
+    if (sizeof(CbItem) != 1) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    cb_span_t spans[2];
+    CbIndex available;
+    cb_result_t result = cb_get_read_spans_ex(cb_ptr, spans, &available);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    cb_frame_view_t v;
+    size_t start, end;
+    cb_frame_view(&v, spans);
+    if (!cb_frame_locate(&v, cb_frame_delimiter(codec), &start, &end)) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    *length = (CbIndex)(end + 1);
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_frame_decode(cb *cb_ptr, cb_frame_codec_t codec, void *dst, size_t capacity, size_t *length) {
+    if (!cb_ptr || !dst || !length) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *length = 0;
+    if (sizeof(CbItem) != 1) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    cb_span_t spans[2];
+    CbIndex available;
+    cb_result_t result = cb_get_read_spans_ex(cb_ptr, spans, &available);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    cb_frame_view_t v;
+    size_t start, end;
+    cb_frame_view(&v, spans);
+    if (!cb_frame_locate(&v, cb_frame_delimiter(codec), &start, &end)) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    size_t produced = 0;
+    if (codec == CB_FRAME_SLIP) {
+        result = cb_frame_decode_slip(&v, start, end, (uint8_t *)dst, capacity, &produced);
+    } else {
+        result = cb_frame_decode_cobs(&v, start, end, (uint8_t *)dst, capacity, &produced);
+    }
+
+    /* Too small a buffer leaves the frame in place; a malformed frame is dropped */
+    if (result == CB_ERROR_INVALID_SIZE) {
+        return result;
+    }
+
+    cb_commit_read_ex(cb_ptr, (CbIndex)(end + 1));
+    if (result != CB_SUCCESS) {
+        CB_RETURN_ERROR(cb_ptr, result, "frame");
+    }
+
+    *length = produced;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_frame_encode(cb *cb_ptr, cb_frame_codec_t codec, const void *data, size_t length) {
+    if (!cb_ptr || (!data && length > 0)) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (sizeof(CbItem) != 1) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    cb_span_t spans[2];
+    CbIndex available;
+    cb_result_t result = cb_get_write_spans_ex(cb_ptr, spans, &available);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    cb_frame_view_t v;
+    cb_frame_view(&v, spans);
+
+    const uint8_t *src = (const uint8_t *)data;
+    size_t w = 0;
+
+    if (codec == CB_FRAME_SLIP) {
+        for (size_t i = 0; i < length; i++) {
+            uint8_t b = src[i];
+            if (b == CB_FRAME_SLIP_END || b == CB_FRAME_SLIP_ESC) {
+                if (w + 2 > v.total) {
+                    return CB_ERROR_BUFFER_FULL;
+                }
+                *cb_frame_at(&v, w++) = CB_FRAME_SLIP_ESC;
+                b = (b == CB_FRAME_SLIP_END) ? CB_FRAME_SLIP_ESC_END : CB_FRAME_SLIP_ESC_ESC;
+            } else if (w + 1 > v.total) {
+                return CB_ERROR_BUFFER_FULL;
+            }
+            *cb_frame_at(&v, w++) = b;
+        }
+    } else {
+        /* Each block starts with a code byte patched once the block ends */
+        size_t code_pos = w++;
+        uint8_t code = 1;
+        if (w > v.total) {
+            return CB_ERROR_BUFFER_FULL;
+        }
+
+        for (size_t i = 0; i < length; i++) {
+            if (src[i] != 0) {
+                if (w + 1 > v.total) {
+                    return CB_ERROR_BUFFER_FULL;
+                }
+                *cb_frame_at(&v, w++) = src[i];
+                code++;
+            }
+            if (src[i] == 0 || code == 0xFF) {
+                if (w + 1 > v.total) {
+                    return CB_ERROR_BUFFER_FULL;
+                }
+                *cb_frame_at(&v, code_pos) = code;
+                code_pos = w++;
+                code = 1;
+            }
+        }
+        *cb_frame_at(&v, code_pos) = code;
+    }
+
+    if (w + 1 > v.total) {
+        return CB_ERROR_BUFFER_FULL;
+    }
+    *cb_frame_at(&v, w++) = cb_frame_delimiter(codec);
+
+    return cb_commit_write_ex(cb_ptr, (CbIndex)w);
+}
@@ -0,0 +1,70 @@
+/*
+    @file        cb_frame.h / cb_frame.c
+    @brief       COBS / SLIP frame codecs working directly on ring storage
+    @details
+     - Byte streams from serial-style links arrive in a byte ring as
+       delimited frames: COBS (0x00-delimited) or SLIP (RFC 1055,
+       0xC0-delimited).
+     - `cb_frame_find()` locates the end of the oldest complete frame with
+       `memchr` over both read segments.
+     - `cb_frame_decode()` decodes that frame straight from the two segments
+       into a caller buffer (COBS runs are copied with `memcpy`) and consumes
+       it with one `out` update, with no per-byte `cb_remove()` calls.
+     - `cb_frame_encode()` encodes a payload straight into the two write
+       segments and publishes the whole frame with one `in` update, or
+       nothing if it does not fit.
+     - Empty frames (back-to-back delimiters, e.g. the leading SLIP END many
+       senders emit) are skipped as part of the next frame. An empty SLIP
+       payload is therefore never delivered; empty COBS payloads are.
+
+     Public API:
+       - `cb_frame_find()`   : Ring bytes taken by the oldest complete frame
+       - `cb_frame_decode()` : Decode and consume the oldest complete frame
+       - `cb_frame_encode()` : Encode and publish one frame (all or nothing)
+
+    @note Needs a byte ring (`sizeof(CbItem) == 1`).
+
+    @note A frame longer than the ring can never complete; size the ring for
+         the largest encoded frame plus one byte.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_FRAME_H
+#define CB_FRAME_H
+
+#include <stddef.h>
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* SLIP special bytes (RFC 1055) */
+#define CB_FRAME_SLIP_END     0xC0u
+#define CB_FRAME_SLIP_ESC     0xDBu
+#define CB_FRAME_SLIP_ESC_END 0xDCu
+#define CB_FRAME_SLIP_ESC_ESC 0xDDu
+
+/* Frame codecs */
+typedef enum {
+    CB_FRAME_COBS = 0,              // Consistent Overhead Byte Stuffing, 0x00 delimiter
+    CB_FRAME_SLIP                   // Serial Line IP, 0xC0 delimiter
+} cb_frame_codec_t;
+
+/* Consumer */
+cb_result_t cb_frame_find(cb *cb_ptr, cb_frame_codec_t codec, CbIndex *length);
+cb_result_t cb_frame_decode(cb *cb_ptr, cb_frame_codec_t codec, void *dst, size_t capacity, size_t *length);
+
+/* Producer */
+cb_result_t cb_frame_encode(cb *cb_ptr, cb_frame_codec_t codec, const void *data, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_FRAME_H */
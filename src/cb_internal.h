@@ -0,0 +1,76 @@
+#ifndef CB_INTERNAL_H
+#define CB_INTERNAL_H
+
+/**
+ * @file cb_internal.h
+ * @brief Helpers shared by the cb core and its extension modules
+ *
+ * @note Not part of the public API. Extension modules (cb_splice, ...) include
+ *       this header to record errors and to read/publish the ring indices with
+ *       the same ordering rules as the core insert/remove paths.
+ *
+ * Ordering rules:
+ *   - The owner of an index loads it relaxed.
+ *   - The other side's index is loaded, then a barrier is issued before the
+ *     slots it guards are touched (acquire).
+ *   - A barrier is issued after the slots are written/read and before the
+ *     owned index is published (release).
+ */
+
+#include "cb.h"
+
+/* Internal helper macros for error handling */
+#define CB_SET_ERROR(cb_ptr, err_code, err_func, err_param, err_line) \
+    do { \
+        if (cb_ptr) { \
+            (cb_ptr)->last_error.code = (err_code); \
+            (cb_ptr)->last_error.function = (err_func); \
+            (cb_ptr)->last_error.parameter = (err_param); \
+            (cb_ptr)->last_error.line = (err_line); \
+        } \
+    } while(0)
+
+#define CB_RETURN_ERROR(cb_ptr, err_code, err_param) \
+    do { \
+        CB_SET_ERROR(cb_ptr, err_code, __func__, err_param, __LINE__); \
+        return err_code; \
+    } while(0)
+
+/* Number of used slots between out and in */
+static inline CbIndex cb_internal_used(CbIndex in, CbIndex out, CbIndex size) {
+    return (in >= out) ? (in - out) : (size - out + in);
+}
+
+/* Advance a ring position by count slots (count <= size) */
+static inline CbIndex cb_internal_advance(CbIndex pos, CbIndex count, CbIndex size) {
+    pos += count;
+    return (pos >= size) ? (pos - size) : pos;
+}
+
+/* Load the producer index and order subsequent slot reads (acquire) */
+static inline CbIndex cb_internal_load_in(const cb *cb_ptr) {
+    CbIndex value = (CbIndex)CB_ATOMIC_LOAD(&cb_ptr->in);
+    CB_MEMORY_BARRIER();
+    return value;
+}
+
+/* Load the consumer index and order subsequent slot writes (acquire) */
+static inline CbIndex cb_internal_load_out(const cb *cb_ptr) {
+    CbIndex value = (CbIndex)CB_ATOMIC_LOAD(&cb_ptr->out);
+    CB_MEMORY_BARRIER();
+    return value;
+}
+
+/* Order previous slot writes and publish the producer index (release) */
+static inline void cb_internal_publish_in(cb *cb_ptr, CbIndex value) {
+    CB_MEMORY_BARRIER();
+    CB_ATOMIC_STORE(&cb_ptr->in, value);
+}
+
+/* Order previous slot reads and publish the consumer index (release) */
+static inline void cb_internal_publish_out(cb *cb_ptr, CbIndex value) {
+    CB_MEMORY_BARRIER();
+    CB_ATOMIC_STORE(&cb_ptr->out, value);
+}
+
+#endif /* CB_INTERNAL_H */
@@ -0,0 +1,93 @@
+/*
+    @file        cb_iter.h / cb_iter.c
+    @brief       In-place consumer iteration with software prefetch ahead of `out`
+    @details
+     - See cb_iter.h for the iteration rules.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include "cb_iter.h"
+#include "cb_internal.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define CB_ITER_PREFETCH(addr) __builtin_prefetch((addr), 0, 3)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#define CB_ITER_PREFETCH(addr) _mm_prefetch((const char *)(addr), _MM_HINT_T0)
+#else
+#define CB_ITER_PREFETCH(addr) ((void)(addr))
+#endif
+
+/* Address of the byte `offset` bytes past `out` */
+static inline uint8_t *cb_iter_at(const cb_span_t spans[2], size_t first_bytes, size_t offset) {
+    return (offset < first_bytes) ? (uint8_t *)spans[0].data + offset
+                                  : (uint8_t *)spans[1].data + (offset - first_bytes);
+}
+
+cb_result_t cb_for_each_available(cb *cb_ptr, size_t element_items, size_t prefetch_bytes,
+                                  cb_iter_fn_t fn, void *ctx, CbIndex max, CbIndex *visited) {
+    if (!cb_ptr || !fn || !visited) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *visited = 0;
+    if (element_items == 0 || cb_ptr->size % element_items != 0) {
+        CB_RETURN_ERROR(cb_ptr, CB_ERROR_INVALID_SIZE, "element_items");
+    }
+
+    if (max == 0) {
+        CB_RETURN_ERROR(cb_ptr, CB_ERROR_INVALID_COUNT, "max");
+    }
+
+    cb_span_t spans[2];
+    CbIndex available;
+    cb_result_t result = cb_get_read_spans_ex(cb_ptr, spans, &available);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    CbIndex total = (CbIndex)(available / element_items);
+    if (total == 0) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+    if (total > max) {
+        total = max;
+    }
+
+    const size_t element_bytes = element_items * sizeof(CbItem);
+    const size_t first_bytes = (size_t)spans[0].count * sizeof(CbItem);
+    const size_t limit = (size_t)total * element_bytes;
+    const bool prefetch = prefetch_bytes != CB_ITER_NO_PREFETCH;
+    if (prefetch_bytes == 0) {
+        prefetch_bytes = CB_ITER_PREFETCH_DEFAULT;
+    }
+
+    size_t ahead = 0;
+    CbIndex count = 0;
+    for (size_t offset = 0; count < total; offset += element_bytes) {
+        if (prefetch) {
+            /* Every line up to prefetch_bytes past this element, each once */
+            size_t target = offset + element_bytes + prefetch_bytes;
+            if (target > limit) {
+                target = limit;
+            }
+            for (; ahead < target; ahead += CB_ITER_LINE_SIZE) {
+                CB_ITER_PREFETCH(cb_iter_at(spans, first_bytes, ahead));
+            }
+        }
+
+        count++;
+        if (!fn(cb_iter_at(spans, first_bytes, offset), ctx)) {
+            break;
+        }
+    }
+
+    cb_commit_read_ex(cb_ptr, (CbIndex)(count * element_items));
+    *visited = count;
+    return CB_SUCCESS;
+}
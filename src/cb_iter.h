@@ -0,0 +1,65 @@
+/*
+    @file        cb_iter.h / cb_iter.c
+    @brief       In-place consumer iteration with software prefetch ahead of `out`
+    @details
+     - `cb_for_each_available()` walks the stored elements from `out`, calls a
+       handler on each one in place (no copy), and releases every visited
+       element with a single `out` update at the end.
+     - An element is `element_items` consecutive items, e.g. a fixed-size
+       message in a byte ring. The buffer length must be a multiple of it, so
+       an element never straddles the end of the storage.
+     - Cache lines are prefetched `prefetch_bytes` ahead of the element being
+       handled, each line once, across the wrap. Handlers of 64-256 byte
+       elements then find the next elements in cache instead of stalling on
+       every slot.
+     - A handler may stop the walk early by returning false; the element it
+       was given still counts as consumed.
+
+     Public API:
+       - `cb_for_each_available()` : Visit up to `max` elements in place, release once
+
+    @note The caller must be the only consumer. Handlers must not touch the
+         ring's indices.
+
+    @note The producer must write whole elements only, so that `out` always
+         sits on an element boundary.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_ITER_H
+#define CB_ITER_H
+
+#include <stddef.h>
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CB_ITER_PREFETCH_DEFAULT
+#define CB_ITER_PREFETCH_DEFAULT 4096   // Bytes prefetched ahead when 0 is passed
+#endif
+
+#ifndef CB_ITER_LINE_SIZE
+#define CB_ITER_LINE_SIZE 64            // Prefetch granularity in bytes
+#endif
+
+/* Prefetch distance meaning "do not prefetch" */
+#define CB_ITER_NO_PREFETCH ((size_t)-1)
+
+/* Element handler; return false to stop after this element */
+typedef bool (*cb_iter_fn_t)(void *element, void *ctx);
+
+cb_result_t cb_for_each_available(cb *cb_ptr, size_t element_items, size_t prefetch_bytes,
+                                  cb_iter_fn_t fn, void *ctx, CbIndex max, CbIndex *visited);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_ITER_H */
@@ -0,0 +1,235 @@
+/*
+    @file        cb_mesh.h / cb_mesh.c
+    @brief       All-to-all mesh of SPSC rings between N producers and M consumers
+    @details
+     - See cb_mesh.h for the readiness protocol.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include "cb_mesh.h"
+#include "cb_internal.h"
+#include <string.h>  // For memcpy, memset
+
+/* Readiness words are shared by all producers of a consumer, so they need
+   read-modify-write atomics and a full fence (store-load ordering), which
+   CB_MEMORY_BARRIER does not provide on every target */
+#if defined(__GNUC__) || defined(__clang__)
+#define CB_MESH_LOAD(ptr)        __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define CB_MESH_SET(ptr, bits)   __atomic_fetch_or((ptr), (bits), __ATOMIC_SEQ_CST)
+#define CB_MESH_CLEAR(ptr, bits) __atomic_fetch_and((ptr), ~(bits), __ATOMIC_SEQ_CST)
+#define CB_MESH_FENCE()          __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#elif CB_HAS_C11_ATOMICS
+#define CB_MESH_LOAD(ptr)        atomic_load_explicit((_Atomic(uint32_t) *)(ptr), memory_order_acquire)
+#define CB_MESH_SET(ptr, bits)   atomic_fetch_or((_Atomic(uint32_t) *)(ptr), (bits))
+#define CB_MESH_CLEAR(ptr, bits) atomic_fetch_and((_Atomic(uint32_t) *)(ptr), ~(bits))
+#define CB_MESH_FENCE()          atomic_thread_fence(memory_order_seq_cst)
+#else
+#error "cb_mesh needs GCC/Clang atomic builtins or C11 atomics"
+#endif
+
+/* Producer side: flag the channel after its data was published */
+static void cb_mesh_mark(cb_mesh_t *mesh, unsigned producer, unsigned dst) {
+    uint32_t bit = (uint32_t)1u << producer;
+    uint32_t *ready = &mesh->state[dst].ready;
+
+    /* Order the `in` publish before the readiness check (pairs with cb_mesh_idle) */
+    CB_MESH_FENCE();
+    if ((CB_MESH_LOAD(ready) & bit) == 0) {
+        CB_MESH_SET(ready, bit);
+    }
+}
+
+/* Consumer side: clear a channel found empty; false if data slipped in meanwhile */
+static bool cb_mesh_idle(cb_mesh_t *mesh, unsigned consumer, unsigned producer) {
+    uint32_t bit = (uint32_t)1u << producer;
+    cb *ring = &mesh->rings[producer * mesh->consumers + consumer];
+
+    CB_MESH_CLEAR(&mesh->state[consumer].ready, bit);
+    CB_MESH_FENCE();
+    if (cb_dataSize(ring) == 0) {
+        return true;
+    }
+    CB_MESH_SET(&mesh->state[consumer].ready, bit);
+    return false;
+}
+
+/* Next ready producer at or after the consumer's cursor, or -1 */
+static int cb_mesh_next(const cb_mesh_t *mesh, unsigned consumer, uint32_t ready) {
+    unsigned start = mesh->state[consumer].cursor;
+
+    for (unsigned i = 0; i < mesh->producers; i++) {
+        unsigned p = start + i;
+        if (p >= mesh->producers) {
+            p -= mesh->producers;
+        }
+        if (ready & ((uint32_t)1u << p)) {
+            return (int)p;
+        }
+    }
+    return -1;
+}
+
+cb_result_t cb_mesh_init(cb_mesh_t *mesh, unsigned producers, unsigned consumers,
+                         cb rings[], CbItem storage[], CbIndex ring_length) {
+    if (!mesh || !rings || !storage) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (producers == 0 || producers > CB_MESH_MAX_PRODUCERS ||
+        consumers == 0 || consumers > CB_MESH_MAX_CONSUMERS) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    memset(mesh, 0, sizeof(*mesh));
+    for (unsigned i = 0; i < producers * consumers; i++) {
+        cb_result_t result = cb_init_ex(&rings[i], &storage[(size_t)i * ring_length], ring_length);
+        if (result != CB_SUCCESS) {
+            return result;
+        }
+    }
+
+    mesh->rings = rings;
+    mesh->producers = producers;
+    mesh->consumers = consumers;
+    return CB_SUCCESS;
+}
+
+cb *cb_mesh_channel(cb_mesh_t *mesh, unsigned producer, unsigned consumer) {
+    if (!mesh || producer >= mesh->producers || consumer >= mesh->consumers) {
+        return NULL;
+    }
+    return &mesh->rings[producer * mesh->consumers + consumer];
+}
+
+cb_result_t cb_mesh_send(cb_mesh_t *mesh, unsigned producer, unsigned dst, CbItem item) {
+    cb *ring = cb_mesh_channel(mesh, producer, dst);
+    if (!ring) {
+        return mesh ? CB_ERROR_INVALID_PARAMETER : CB_ERROR_NULL_POINTER;
+    }
+
+    cb_result_t result = cb_insert_ex(ring, item);
+    if (result == CB_SUCCESS) {
+        cb_mesh_mark(mesh, producer, dst);
+    }
+    return result;
+}
+
+cb_result_t cb_mesh_send_bulk(cb_mesh_t *mesh, unsigned producer, unsigned dst,
+                              const CbItem *items, CbIndex count, CbIndex *sent) {
+    if (!mesh || !items || !sent) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *sent = 0;
+    cb *ring = cb_mesh_channel(mesh, producer, dst);
+    if (!ring) {
+        return CB_ERROR_INVALID_PARAMETER;
+    }
+
+    if (count == 0) {
+        CB_RETURN_ERROR(ring, CB_ERROR_INVALID_COUNT, "count");
+    }
+
+    cb_span_t spans[2];
+    CbIndex available;
+    cb_result_t result = cb_get_write_spans_ex(ring, spans, &available);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    CbIndex n = (count < available) ? count : available;
+    CbIndex first = (n < spans[0].count) ? n : spans[0].count;
+    memcpy(spans[0].data, items, (size_t)first * sizeof(CbItem));
+    if (n > first) {
+        memcpy(spans[1].data, items + first, (size_t)(n - first) * sizeof(CbItem));
+    }
+
+    cb_commit_write_ex(ring, n);
+    cb_mesh_mark(mesh, producer, dst);
+    *sent = n;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_mesh_recv_any(cb_mesh_t *mesh, unsigned consumer, CbItem *item, unsigned *from) {
+    if (!mesh || !item || !from) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (consumer >= mesh->consumers) {
+        return CB_ERROR_INVALID_PARAMETER;
+    }
+
+    uint32_t ready = CB_MESH_LOAD(&mesh->state[consumer].ready);
+    int p;
+    while ((p = cb_mesh_next(mesh, consumer, ready)) >= 0) {
+        cb *ring = &mesh->rings[(unsigned)p * mesh->consumers + consumer];
+        if (cb_remove_ex(ring, item) == CB_SUCCESS) {
+            mesh->state[consumer].cursor = ((unsigned)p + 1 < mesh->producers) ? (unsigned)p + 1 : 0;
+            *from = (unsigned)p;
+            return CB_SUCCESS;
+        }
+
+        if (cb_mesh_idle(mesh, consumer, (unsigned)p)) {
+            ready &= ~((uint32_t)1u << p);
+        }
+    }
+
+    return CB_ERROR_BUFFER_EMPTY;
+}
+
+cb_result_t cb_mesh_recv_bulk(cb_mesh_t *mesh, unsigned consumer, CbItem *items, CbIndex max,
+                              CbIndex *received, unsigned *from) {
+    if (!mesh || !items || !received || !from) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *received = 0;
+    if (consumer >= mesh->consumers) {
+        return CB_ERROR_INVALID_PARAMETER;
+    }
+
+    if (max == 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    uint32_t ready = CB_MESH_LOAD(&mesh->state[consumer].ready);
+    int p;
+    while ((p = cb_mesh_next(mesh, consumer, ready)) >= 0) {
+        cb *ring = &mesh->rings[(unsigned)p * mesh->consumers + consumer];
+        cb_span_t spans[2];
+        CbIndex available;
+
+        if (cb_get_read_spans_ex(ring, spans, &available) == CB_SUCCESS) {
+            CbIndex n = (max < available) ? max : available;
+            CbIndex first = (n < spans[0].count) ? n : spans[0].count;
+            memcpy(items, spans[0].data, (size_t)first * sizeof(CbItem));
+            if (n > first) {
+                memcpy(items + first, spans[1].data, (size_t)(n - first) * sizeof(CbItem));
+            }
+            cb_commit_read_ex(ring, n);
+
+            mesh->state[consumer].cursor = ((unsigned)p + 1 < mesh->producers) ? (unsigned)p + 1 : 0;
+            *received = n;
+            *from = (unsigned)p;
+            return CB_SUCCESS;
+        }
+
+        if (cb_mesh_idle(mesh, consumer, (unsigned)p)) {
+            ready &= ~((uint32_t)1u << p);
+        }
+    }
+
+    return CB_ERROR_BUFFER_EMPTY;
+}
+
+uint32_t cb_mesh_ready(const cb_mesh_t *mesh, unsigned consumer) {
+    if (!mesh || consumer >= mesh->consumers) {
+        return 0;
+    }
+    return CB_MESH_LOAD(&mesh->state[consumer].ready);
+}
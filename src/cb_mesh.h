@@ -0,0 +1,91 @@
+/*
+    @file        cb_mesh.h / cb_mesh.c
+    @brief       All-to-all mesh of SPSC rings between N producers and M consumers
+    @details
+     - Producer `p` and consumer `c` share the dedicated ring `p * M + c`, so
+       every channel keeps the single-producer/single-consumer lock-free path
+       and no two threads ever write the same index.
+     - Each consumer has a readiness word with one bit per producer. A send
+       sets the producer's bit after publishing, and only if it is not
+       already set, so a busy channel costs no atomic read-modify-write.
+     - `cb_mesh_recv_any()` reads the readiness word instead of polling all N
+       rings, and serves ready producers round-robin from a per-consumer
+       cursor. A bit is cleared when its ring is found empty, then the ring
+       is checked once more, so a concurrent send is never missed.
+     - Bulk sends and receives copy through the ring spans and publish once.
+       A bulk receive takes items from one producer only, so the caller
+       always knows where they came from.
+
+     Public API:
+       - `cb_mesh_init()`      : Set up the N x M rings over one storage block
+       - `cb_mesh_send()`      : Send one item from a producer to a consumer
+       - `cb_mesh_send_bulk()` : Send up to N items with one publish
+       - `cb_mesh_recv_any()`  : Receive one item from the next ready producer
+       - `cb_mesh_recv_bulk()` : Receive up to N items from the next ready producer
+       - `cb_mesh_ready()`     : Readiness bits of a consumer
+       - `cb_mesh_channel()`   : Ring between a producer and a consumer
+
+    @note Each producer index must be used by one thread only, and likewise
+         each consumer index.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_MESH_H
+#define CB_MESH_H
+
+#include <stddef.h>
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CB_MESH_MAX_PRODUCERS 32    // One readiness bit per producer
+
+#ifndef CB_MESH_MAX_CONSUMERS
+#define CB_MESH_MAX_CONSUMERS 32
+#endif
+
+#ifndef CB_MESH_LINE_SIZE
+#define CB_MESH_LINE_SIZE 64        // Padding between consumers' readiness words
+#endif
+
+typedef struct {
+    uint32_t ready;                 // Bit p set: producer p may have items
+    unsigned cursor;                // Next producer to serve
+    uint8_t pad[CB_MESH_LINE_SIZE - sizeof(uint32_t) - sizeof(unsigned)];
+} cb_mesh_consumer_t;
+
+typedef struct {
+    cb *rings;                      // producers x consumers, producer-major
+    unsigned producers;
+    unsigned consumers;
+    cb_mesh_consumer_t state[CB_MESH_MAX_CONSUMERS];
+} cb_mesh_t;
+
+cb_result_t cb_mesh_init(cb_mesh_t *mesh, unsigned producers, unsigned consumers,
+                         cb rings[], CbItem storage[], CbIndex ring_length);
+
+/* Producer side */
+cb_result_t cb_mesh_send(cb_mesh_t *mesh, unsigned producer, unsigned dst, CbItem item);
+cb_result_t cb_mesh_send_bulk(cb_mesh_t *mesh, unsigned producer, unsigned dst,
+                              const CbItem *items, CbIndex count, CbIndex *sent);
+
+/* Consumer side */
+cb_result_t cb_mesh_recv_any(cb_mesh_t *mesh, unsigned consumer, CbItem *item, unsigned *from);
+cb_result_t cb_mesh_recv_bulk(cb_mesh_t *mesh, unsigned consumer, CbItem *items, CbIndex max,
+                              CbIndex *received, unsigned *from);
+uint32_t cb_mesh_ready(const cb_mesh_t *mesh, unsigned consumer);
+
+cb *cb_mesh_channel(cb_mesh_t *mesh, unsigned producer, unsigned consumer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_MESH_H */
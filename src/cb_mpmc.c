@@ -0,0 +1,235 @@
+/*
+    @file        cb_mpmc.h / cb_mpmc.c
+    @brief       Multi-producer/multi-consumer ring with burst reservation
+    @details
+     - See cb_mpmc.h for the head/tail protocol.
+     - The tail wait is an acquire and the tail store a release, so a
+       thread that sees the new tail also sees every slot written (or
+       freed) before it, including those of earlier reservations.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include "cb_mpmc.h"
+#include "cb_internal.h"
+#include <string.h>  // For memcpy
+#if defined(__unix__) || defined(__APPLE__)
+#include <sched.h>   // For sched_yield
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define CB_MPMC_LOAD(ptr)          __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define CB_MPMC_LOAD_RELAXED(ptr)  __atomic_load_n((ptr), __ATOMIC_RELAXED)
+#define CB_MPMC_STORE(ptr, val)    __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+#define CB_MPMC_CAS(ptr, exp, val) __atomic_compare_exchange_n((ptr), (exp), (val), true, \
+                                                               __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#elif CB_HAS_C11_ATOMICS
+#define CB_MPMC_LOAD(ptr)          atomic_load_explicit((_Atomic(uint32_t) *)(ptr), memory_order_acquire)
+#define CB_MPMC_LOAD_RELAXED(ptr)  atomic_load_explicit((_Atomic(uint32_t) *)(ptr), memory_order_relaxed)
+#define CB_MPMC_STORE(ptr, val)    atomic_store_explicit((_Atomic(uint32_t) *)(ptr), (val), memory_order_release)
+#define CB_MPMC_CAS(ptr, exp, val) atomic_compare_exchange_weak_explicit((_Atomic(uint32_t) *)(ptr), (exp), (val), \
+                                                                         memory_order_acq_rel, memory_order_acquire)
+#else
+#error "cb_mpmc needs GCC/Clang atomic builtins or C11 atomics"
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CB_MPMC_RELAX() __builtin_ia32_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#define CB_MPMC_RELAX() __asm__ __volatile__("yield" ::: "memory")
+#else
+#define CB_MPMC_RELAX() __asm__ __volatile__("" ::: "memory")
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CB_MPMC_YIELD() sched_yield()
+#else
+#define CB_MPMC_YIELD() CB_MPMC_RELAX()
+#endif
+
+/* Reserve up to `count` slots on `side`, which may run `offset` slots past the
+   other side's tail. Returns the number reserved, 0 if none. */
+static uint32_t cb_mpmc_reserve(cb_mpmc_headtail_t *side, const uint32_t *other_tail, uint32_t offset,
+                                uint32_t count, bool all_or_nothing, uint32_t *start) {
+    uint32_t head = CB_MPMC_LOAD_RELAXED(&side->head);
+    uint32_t n;
+
+    do {
+        uint32_t available = CB_MPMC_LOAD(other_tail) + offset - head;
+        n = count;
+        if (n > available) {
+            if (all_or_nothing) {
+                return 0;
+            }
+            n = available;
+        }
+        if (n == 0) {
+            return 0;
+        }
+    } while (!CB_MPMC_CAS(&side->head, &head, head + n));
+
+    *start = head;
+    return n;
+}
+
+/* Publish the `n` slots reserved at `start` once every earlier reservation on
+   `side` has been published: spin briefly, then yield to the thread behind */
+static void cb_mpmc_publish(cb_mpmc_headtail_t *side, uint32_t start, uint32_t n) {
+    unsigned spins = 0;
+
+    while (CB_MPMC_LOAD(&side->tail) != start) {
+        if (spins < CB_MPMC_SPIN) {
+            spins++;
+            CB_MPMC_RELAX();
+        } else {
+            CB_MPMC_YIELD();
+        }
+    }
+    CB_MPMC_STORE(&side->tail, start + n);
+}
+
+/* Storage slot of a position; interleaved rings rotate the index left so that
+   its low bits pick the cache line and its high bits the item within it */
+static inline uint32_t cb_mpmc_slot(const cb_mpmc_t *q, uint32_t pos) {
+    uint32_t index = pos & q->mask;
+    return ((index << q->rotate) | (index >> (q->bits - q->rotate))) & q->mask;
+}
+
+static uint32_t cb_mpmc_enqueue(cb_mpmc_t *q, const CbItem *items, uint32_t count, bool all_or_nothing) {
+    uint32_t start;
+    uint32_t n = cb_mpmc_reserve(&q->prod, &q->cons.tail, q->size, count, all_or_nothing, &start);
+    if (n == 0) {
+        return 0;
+    }
+
+    if (q->rotate) {
+        for (uint32_t i = 0; i < n; i++) {
+            q->buf[cb_mpmc_slot(q, start + i)] = items[i];
+        }
+    } else {
+        uint32_t index = start & q->mask;
+        uint32_t first = (n < q->size - index) ? n : q->size - index;
+        memcpy(&q->buf[index], items, (size_t)first * sizeof(CbItem));
+        if (n > first) {
+            memcpy(q->buf, items + first, (size_t)(n - first) * sizeof(CbItem));
+        }
+    }
+
+    cb_mpmc_publish(&q->prod, start, n);
+    return n;
+}
+
+static uint32_t cb_mpmc_dequeue(cb_mpmc_t *q, CbItem *items, uint32_t count, bool all_or_nothing) {
+    uint32_t start;
+    uint32_t n = cb_mpmc_reserve(&q->cons, &q->prod.tail, 0, count, all_or_nothing, &start);
+    if (n == 0) {
+        return 0;
+    }
+
+    if (q->rotate) {
+        for (uint32_t i = 0; i < n; i++) {
+            items[i] = q->buf[cb_mpmc_slot(q, start + i)];
+        }
+    } else {
+        uint32_t index = start & q->mask;
+        uint32_t first = (n < q->size - index) ? n : q->size - index;
+        memcpy(items, &q->buf[index], (size_t)first * sizeof(CbItem));
+        if (n > first) {
+            memcpy(items + first, q->buf, (size_t)(n - first) * sizeof(CbItem));
+        }
+    }
+
+    cb_mpmc_publish(&q->cons, start, n);
+    return n;
+}
+
+cb_result_t cb_mpmc_init(cb_mpmc_t *q, CbItem storage[], uint32_t length, unsigned flags) {
+    if (!q || !storage) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (length == 0 || (length & (length - 1)) != 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    memset(q, 0, sizeof(*q));
+    q->buf = storage;
+    q->size = length;
+    q->mask = length - 1;
+    while ((1u << q->bits) < length) {
+        q->bits++;
+    }
+
+    if (flags & CB_MPMC_INTERLEAVE) {
+        /* Smallest power-of-two stride that spans a cache line; rings of one stride or less stay linear */
+        uint32_t rotate = 0;
+        while (((size_t)1 << rotate) * sizeof(CbItem) < CB_MPMC_LINE_SIZE) {
+            rotate++;
+        }
+        q->rotate = (rotate < q->bits) ? rotate : 0;
+    }
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_mpmc_enqueue_bulk(cb_mpmc_t *q, const CbItem *items, uint32_t count) {
+    if (!q || !items) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (count == 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    return (cb_mpmc_enqueue(q, items, count, true) == count) ? CB_SUCCESS : CB_ERROR_BUFFER_FULL;
+}
+
+cb_result_t cb_mpmc_enqueue_burst(cb_mpmc_t *q, const CbItem *items, uint32_t count, uint32_t *enqueued) {
+    if (!q || !items || !enqueued) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *enqueued = 0;
+    if (count == 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    *enqueued = cb_mpmc_enqueue(q, items, count, false);
+    return (*enqueued > 0) ? CB_SUCCESS : CB_ERROR_BUFFER_FULL;
+}
+
+cb_result_t cb_mpmc_dequeue_bulk(cb_mpmc_t *q, CbItem *items, uint32_t count) {
+    if (!q || !items) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (count == 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    return (cb_mpmc_dequeue(q, items, count, true) == count) ? CB_SUCCESS : CB_ERROR_BUFFER_EMPTY;
+}
+
+cb_result_t cb_mpmc_dequeue_burst(cb_mpmc_t *q, CbItem *items, uint32_t max, uint32_t *dequeued) {
+    if (!q || !items || !dequeued) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *dequeued = 0;
+    if (max == 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    *dequeued = cb_mpmc_dequeue(q, items, max, false);
+    return (*dequeued > 0) ? CB_SUCCESS : CB_ERROR_BUFFER_EMPTY;
+}
+
+uint32_t cb_mpmc_count(const cb_mpmc_t *q) {
+    if (!q) {
+        return 0;
+    }
+    return CB_MPMC_LOAD(&q->prod.tail) - CB_MPMC_LOAD(&q->cons.tail);
+}
@@ -0,0 +1,103 @@
+/*
+    @file        cb_mpmc.h / cb_mpmc.c
+    @brief       Multi-producer/multi-consumer ring with burst reservation
+    @details
+     - Producers and consumers each have a head and a tail. A producer
+       reserves a whole burst with one compare-and-swap on the producer
+       head, copies the items, then publishes with one compare-and-swap on
+       the producer tail. Consumers do the same on the consumer head and
+       tail. Atomic cost is paid once per burst, not once per item.
+     - Tails advance in reservation order: a thread waits until the tail
+       reaches the start of its own reservation, then moves it past the
+       end. It spins with a pause for `CB_MPMC_SPIN` rounds, then yields
+       the CPU to the thread it waits for. Each finished burst becomes
+       visible as soon as the ones before it have been published.
+     - Bulk calls are all-or-nothing: they move exactly `count` items or
+       none. Burst calls move as many as fit, like `cb_insert_bulk_ex()`
+       and `cb_remove_bulk_ex()`.
+     - Indices run freely and are masked on access, so the length must be
+       a power of two and every slot can be used.
+     - The producer and consumer index pairs sit on separate cache lines.
+     - With `CB_MPMC_INTERLEAVE`, slot positions are remapped by rotating
+       the slot index, so consecutive positions land at least one cache
+       line apart. Producers filling neighbouring slots, and a consumer
+       reading right behind a producer, then touch different lines. Bursts
+       are copied item by item in this mode; the API is unchanged.
+
+     Public API:
+       - `cb_mpmc_init()`          : Set up a ring over caller storage, optionally interleaved
+       - `cb_mpmc_enqueue_bulk()`  : Enqueue exactly N items or none
+       - `cb_mpmc_enqueue_burst()` : Enqueue up to N items
+       - `cb_mpmc_dequeue_bulk()`  : Dequeue exactly N items or none
+       - `cb_mpmc_dequeue_burst()` : Dequeue up to N items
+       - `cb_mpmc_count()`         : Items currently published
+
+    @note Threads of one side finish in reservation order. One preempted
+         between its reservation and its publish stalls every later thread
+         of that side in the tail wait until it runs again. With more
+         threads than CPUs such stalls can chain into a convoy, so size the
+         thread count to the CPUs available.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_MPMC_H
+#define CB_MPMC_H
+
+#include <stddef.h>
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CB_MPMC_LINE_SIZE
+#define CB_MPMC_LINE_SIZE 64
+#endif
+
+#ifndef CB_MPMC_SPIN
+#define CB_MPMC_SPIN 128            // Tail-wait pauses before yielding
+#endif
+
+/* Free-running positions of one side */
+typedef struct {
+    uint32_t head;                  // Next slot to reserve
+    uint32_t tail;                  // Slots before this one are published
+    uint8_t pad[CB_MPMC_LINE_SIZE - 2 * sizeof(uint32_t)];
+} cb_mpmc_headtail_t;
+
+/* cb_mpmc_init() flags */
+#define CB_MPMC_INTERLEAVE 0x1u     // Spread consecutive slots across cache lines
+
+typedef struct {
+    CbItem *buf;
+    uint32_t size;                  // Power of two
+    uint32_t mask;
+    uint32_t bits;                  // log2(size)
+    uint32_t rotate;                // Slot index rotation, 0 when not interleaved
+    uint8_t pad[CB_MPMC_LINE_SIZE - sizeof(CbItem *) - 4 * sizeof(uint32_t)];
+    cb_mpmc_headtail_t prod;
+    cb_mpmc_headtail_t cons;
+} cb_mpmc_t;
+
+cb_result_t cb_mpmc_init(cb_mpmc_t *q, CbItem storage[], uint32_t length, unsigned flags);
+
+/* Producer side, any thread */
+cb_result_t cb_mpmc_enqueue_bulk(cb_mpmc_t *q, const CbItem *items, uint32_t count);
+cb_result_t cb_mpmc_enqueue_burst(cb_mpmc_t *q, const CbItem *items, uint32_t count, uint32_t *enqueued);
+
+/* Consumer side, any thread */
+cb_result_t cb_mpmc_dequeue_bulk(cb_mpmc_t *q, CbItem *items, uint32_t count);
+cb_result_t cb_mpmc_dequeue_burst(cb_mpmc_t *q, CbItem *items, uint32_t max, uint32_t *dequeued);
+
+uint32_t cb_mpmc_count(const cb_mpmc_t *q);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_MPMC_H */
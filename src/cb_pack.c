@@ -0,0 +1,407 @@
+/*
+    @file        cb_pack.h / cb_pack.c
+    @brief       Bit-packed ring for samples of 1 to 32 bits
+    @details
+     - See cb_pack.h for the storage layout.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include "cb_pack.h"
+#include "cb_internal.h"
+#include <string.h>  // For memcpy
+
+/* Samples per group; a group always starts and ends on a byte boundary */
+#define CB_PACK_GROUP 8u
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define CB_PACK_HAS_SSSE3 1
+    #include <tmmintrin.h>
+#else
+    #define CB_PACK_HAS_SSSE3 0
+#endif
+
+/* Relaxed byte access for the scalar path: a byte can hold samples of both the
+   producer and the consumer when the width is not a multiple of 8 */
+#if defined(__GNUC__) || defined(__clang__)
+    #define CB_PACK_LOAD_BYTE(ptr)       __atomic_load_n((ptr), __ATOMIC_RELAXED)
+    #define CB_PACK_STORE_BYTE(ptr, val) __atomic_store_n((ptr), (val), __ATOMIC_RELAXED)
+#else
+    #define CB_PACK_LOAD_BYTE(ptr)       (*(volatile const uint8_t *)(ptr))
+    #define CB_PACK_STORE_BYTE(ptr, val) (*(volatile uint8_t *)(ptr) = (val))
+#endif
+
+/* Scalar access to one sample at a bit position (little-endian bit order) */
+static void cb_pack_put(uint8_t *bytes, size_t bitpos, unsigned bits, uint32_t v) {
+    uint8_t *p = bytes + bitpos / 8;
+    unsigned shift = (unsigned)(bitpos % 8);
+    uint64_t field = (uint64_t)v << shift;
+    uint64_t mask = (((uint64_t)1 << bits) - 1) << shift;
+    unsigned n = (shift + bits + 7) / 8;
+
+    for (unsigned i = 0; i < n; i++) {
+        uint8_t m = (uint8_t)(mask >> (8 * i));
+        uint8_t old = CB_PACK_LOAD_BYTE(&p[i]);
+        CB_PACK_STORE_BYTE(&p[i], (uint8_t)((old & ~m) | ((uint8_t)(field >> (8 * i)) & m)));
+    }
+}
+
+static uint32_t cb_pack_get(const uint8_t *bytes, size_t bitpos, unsigned bits) {
+    const uint8_t *p = bytes + bitpos / 8;
+    unsigned shift = (unsigned)(bitpos % 8);
+    unsigned n = (shift + bits + 7) / 8;
+    uint64_t window = 0;
+
+    for (unsigned i = 0; i < n; i++) {
+        window |= (uint64_t)CB_PACK_LOAD_BYTE(&p[i]) << (8 * i);
+    }
+    return (uint32_t)((window >> shift) & (((uint64_t)1 << bits) - 1));
+}
+
+/* Pack 8 masked samples into `bits` bytes */
+static void cb_pack_group(uint8_t *dst, const uint32_t *src, unsigned bits, uint32_t mask) {
+    uint64_t acc = 0;
+    unsigned filled = 0;
+
+    for (unsigned i = 0; i < CB_PACK_GROUP; i++) {
+        acc |= (uint64_t)(src[i] & mask) << filled;
+        filled += bits;
+        while (filled >= 8) {
+            *dst++ = (uint8_t)acc;
+            acc >>= 8;
+            filled -= 8;
+        }
+    }
+}
+
+/* Unpack `bits` bytes into 8 samples */
+static void cb_unpack_group(uint32_t *dst, const uint8_t *src, unsigned bits, uint32_t mask) {
+    uint64_t acc = 0;
+    unsigned filled = 0;
+
+    for (unsigned i = 0; i < CB_PACK_GROUP; i++) {
+        while (filled < bits) {
+            acc |= (uint64_t)*src++ << filled;
+            filled += 8;
+        }
+        dst[i] = (uint32_t)acc & mask;
+        acc >>= bits;
+        filled -= bits;
+    }
+}
+
+#if CB_PACK_HAS_SSSE3
+/* 12-bit groups: 8 samples <-> 12 bytes with byte shuffles */
+__attribute__((target("ssse3")))
+static void cb_pack_group12_ssse3(uint8_t *dst, const uint32_t *src) {
+    const __m128i low12 = _mm_set1_epi32(0x00000FFF);
+    const __m128i high12 = _mm_set1_epi32(0x00FFF000);
+    const __m128i compact = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+
+    __m128i a = _mm_and_si128(_mm_loadu_si128((const __m128i *)src), low12);
+    __m128i b = _mm_and_si128(_mm_loadu_si128((const __m128i *)(src + 4)), low12);
+    __m128i pairs = _mm_packs_epi32(a, b);  // 16-bit lanes s0..s7
+
+    /* Each 32-bit lane now holds s[2k] | s[2k+1] << 16; move s[2k+1] down to bit 12 */
+    __m128i merged = _mm_or_si128(_mm_and_si128(pairs, low12),
+                                  _mm_and_si128(_mm_srli_epi32(pairs, 4), high12));
+    __m128i packed = _mm_shuffle_epi8(merged, compact);
+
+    _mm_storel_epi64((__m128i *)dst, packed);
+    uint32_t tail = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(packed, 8));
+    memcpy(dst + 8, &tail, sizeof(tail));
+}
+
+__attribute__((target("ssse3")))
+static void cb_unpack_group12_ssse3(uint32_t *dst, const uint8_t *src) {
+    const __m128i spread = _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11);
+    const __m128i even = _mm_set1_epi32(0x00000FFF);
+    const __m128i odd = _mm_set1_epi32((int)0xFFFF0000);
+    const __m128i zero = _mm_setzero_si128();
+
+    uint8_t window[16];
+    memcpy(window, src, 12);
+    memset(window + 12, 0, 4);
+
+    /* 16-bit lane k holds the two bytes that contain sample k */
+    __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)window), spread);
+    __m128i samples = _mm_or_si128(_mm_and_si128(v, even),
+                                   _mm_and_si128(_mm_srli_epi16(v, 4), odd));
+
+    _mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi16(samples, zero));
+    _mm_storeu_si128((__m128i *)(dst + 4), _mm_unpackhi_epi16(samples, zero));
+}
+
+static bool cb_pack_ssse3(void) {
+    static int supported = -1;
+
+    if (supported < 0) {
+        __builtin_cpu_init();
+        supported = __builtin_cpu_supports("ssse3") ? 1 : 0;
+    }
+    return supported == 1;
+}
+#endif
+
+/* Pack `groups` whole groups; byte-sized widths are plain copies */
+static void cb_pack_groups(const cb_pack_t *p, uint8_t *dst, const uint32_t *src, size_t groups) {
+    size_t n = groups * CB_PACK_GROUP;
+
+    switch (p->bits) {
+        case 8:
+            for (size_t i = 0; i < n; i++) {
+                dst[i] = (uint8_t)src[i];
+            }
+            return;
+        case 16:
+            for (size_t i = 0; i < n; i++) {
+                dst[2 * i] = (uint8_t)src[i];
+                dst[2 * i + 1] = (uint8_t)(src[i] >> 8);
+            }
+            return;
+        case 32:
+            for (size_t i = 0; i < n; i++) {
+                dst[4 * i] = (uint8_t)src[i];
+                dst[4 * i + 1] = (uint8_t)(src[i] >> 8);
+                dst[4 * i + 2] = (uint8_t)(src[i] >> 16);
+                dst[4 * i + 3] = (uint8_t)(src[i] >> 24);
+            }
+            return;
+        default:
+            break;
+    }
+
+#if CB_PACK_HAS_SSSE3
+    if (p->bits == 12 && cb_pack_ssse3()) {
+        for (size_t g = 0; g < groups; g++) {
+            cb_pack_group12_ssse3(dst + g * 12, src + g * CB_PACK_GROUP);
+        }
+        return;
+    }
+#endif
+
+    for (size_t g = 0; g < groups; g++) {
+        cb_pack_group(dst + g * p->bits, src + g * CB_PACK_GROUP, p->bits, p->mask);
+    }
+}
+
+static void cb_unpack_groups(const cb_pack_t *p, uint32_t *dst, const uint8_t *src, size_t groups) {
+    size_t n = groups * CB_PACK_GROUP;
+
+    switch (p->bits) {
+        case 8:
+            for (size_t i = 0; i < n; i++) {
+                dst[i] = src[i];
+            }
+            return;
+        case 16:
+            for (size_t i = 0; i < n; i++) {
+                dst[i] = (uint32_t)src[2 * i] | ((uint32_t)src[2 * i + 1] << 8);
+            }
+            return;
+        case 32:
+            for (size_t i = 0; i < n; i++) {
+                dst[i] = (uint32_t)src[4 * i] | ((uint32_t)src[4 * i + 1] << 8) |
+                         ((uint32_t)src[4 * i + 2] << 16) | ((uint32_t)src[4 * i + 3] << 24);
+            }
+            return;
+        default:
+            break;
+    }
+
+#if CB_PACK_HAS_SSSE3
+    if (p->bits == 12 && cb_pack_ssse3()) {
+        for (size_t g = 0; g < groups; g++) {
+            cb_unpack_group12_ssse3(dst + g * CB_PACK_GROUP, src + g * 12);
+        }
+        return;
+    }
+#endif
+
+    for (size_t g = 0; g < groups; g++) {
+        cb_unpack_group(dst + g * CB_PACK_GROUP, src + g * p->bits, p->bits, p->mask);
+    }
+}
+
+/* Store n samples starting at slot pos, wrapping at the end of the ring */
+static void cb_pack_store(cb_pack_t *p, CbIndex pos, const uint32_t *src, CbIndex n) {
+    CbIndex slots = p->ring.size;
+
+    while (n > 0) {
+        if (pos % CB_PACK_GROUP != 0 || n < CB_PACK_GROUP) {
+            /* Head and tail samples share bytes with neighbouring slots */
+            cb_pack_put(p->bytes, (size_t)pos * p->bits, p->bits, *src & p->mask);
+            src++;
+            n--;
+            pos = (pos + 1 == slots) ? 0 : pos + 1;
+            continue;
+        }
+
+        /* Slots are a multiple of the group size, so groups never wrap */
+        CbIndex run = slots - pos;
+        if (run > n) {
+            run = n;
+        }
+        run -= run % CB_PACK_GROUP;
+
+        cb_pack_groups(p, p->bytes + ((size_t)pos / CB_PACK_GROUP) * p->bits, src, run / CB_PACK_GROUP);
+        src += run;
+        n -= run;
+        pos = cb_internal_advance(pos, run, slots);
+    }
+}
+
+/* Load n samples starting at slot pos, wrapping at the end of the ring */
+static void cb_pack_load(const cb_pack_t *p, CbIndex pos, uint32_t *dst, CbIndex n) {
+    CbIndex slots = p->ring.size;
+
+    while (n > 0) {
+        if (pos % CB_PACK_GROUP != 0 || n < CB_PACK_GROUP) {
+            *dst++ = cb_pack_get(p->bytes, (size_t)pos * p->bits, p->bits);
+            n--;
+            pos = (pos + 1 == slots) ? 0 : pos + 1;
+            continue;
+        }
+
+        CbIndex run = slots - pos;
+        if (run > n) {
+            run = n;
+        }
+        run -= run % CB_PACK_GROUP;
+
+        cb_unpack_groups(p, dst, p->bytes + ((size_t)pos / CB_PACK_GROUP) * p->bits, run / CB_PACK_GROUP);
+        dst += run;
+        n -= run;
+        pos = cb_internal_advance(pos, run, slots);
+    }
+}
+
+cb_result_t cb_pack_init(cb_pack_t *p, void *storage, size_t storage_bytes, unsigned bits) {
+    if (!p || !storage) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (bits == 0 || bits > 32) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    /* Whole groups only, and no more slots than an index can address */
+    size_t slots = (storage_bytes / bits) * CB_PACK_GROUP;
+    CbIndex max_slots = (CbIndex)~(CbIndex)0;
+    if (slots > (size_t)max_slots) {
+        slots = (size_t)max_slots - (size_t)max_slots % CB_PACK_GROUP;
+    }
+
+    if (slots < CB_PACK_GROUP) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    cb_result_t result = cb_init_ex(&p->ring, (CbItem *)storage, (CbIndex)slots);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    p->bytes = (uint8_t *)storage;
+    p->storage_bytes = storage_bytes;
+    p->bits = bits;
+    p->mask = (bits == 32) ? 0xFFFFFFFFu : ((1u << bits) - 1u);
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_pack_insert(cb_pack_t *p, uint32_t sample) {
+    CbIndex inserted;
+    return cb_pack_insert_bulk(p, &sample, 1, &inserted);
+}
+
+cb_result_t cb_pack_remove(cb_pack_t *p, uint32_t *sample) {
+    CbIndex removed;
+    return cb_pack_remove_bulk(p, sample, 1, &removed);
+}
+
+cb_result_t cb_pack_insert_bulk(cb_pack_t *p, const uint32_t *samples, CbIndex count, CbIndex *inserted) {
+    if (!p || !inserted) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *inserted = 0;
+
+    if (!samples && count > 0) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (p->ring.size == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    if (count == 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    CbIndex current_in = CB_ATOMIC_LOAD(&p->ring.in);
+    CbIndex current_out = cb_internal_load_out(&p->ring);
+    CbIndex free_slots = (p->ring.size - 1) - cb_internal_used(current_in, current_out, p->ring.size);
+
+    if (free_slots == 0) {
+        return CB_ERROR_BUFFER_FULL;
+    }
+
+    CbIndex n = (count < free_slots) ? count : free_slots;
+    cb_pack_store(p, current_in, samples, n);
+    cb_commit_write_ex(&p->ring, n);
+
+    *inserted = n;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_pack_remove_bulk(cb_pack_t *p, uint32_t *samples, CbIndex count, CbIndex *removed) {
+    if (!p || !removed) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *removed = 0;
+
+    if (!samples && count > 0) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (p->ring.size == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    if (count == 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    CbIndex current_out = CB_ATOMIC_LOAD(&p->ring.out);
+    CbIndex current_in = cb_internal_load_in(&p->ring);
+    CbIndex used = cb_internal_used(current_in, current_out, p->ring.size);
+
+    if (used == 0) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    CbIndex n = (count < used) ? count : used;
+    cb_pack_load(p, current_out, samples, n);
+    cb_commit_read_ex(&p->ring, n);
+
+    *removed = n;
+    return CB_SUCCESS;
+}
+
+CbIndex cb_pack_count(cb_pack_t *p) {
+    if (!p) {
+        return 0;
+    }
+    return cb_dataSize(&p->ring);
+}
+
+CbIndex cb_pack_capacity(const cb_pack_t *p) {
+    if (!p || p->ring.size == 0) {
+        return 0;
+    }
+    return p->ring.size - 1;
+}
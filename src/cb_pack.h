@@ -0,0 +1,79 @@
+/*
+    @file        cb_pack.h / cb_pack.c
+    @brief       Bit-packed ring for samples of 1 to 32 bits
+    @details
+     - Each sample takes exactly `bits` bits of storage, so 12-bit ADC
+       samples use 1.5 bytes instead of the 2 bytes of a `uint16_t` buffer.
+     - Samples are passed in and out as `uint32_t`; bits above the width are
+       ignored on insert and zero on remove.
+     - Bulk insert/remove pack and unpack groups of 8 samples, which always
+       occupy exactly `bits` whole bytes. Widths of 8, 16 and 32 bits use
+       plain byte copies; 12-bit groups use SSSE3 shuffles on x86 CPUs that
+       support them (detected at run time with GCC/Clang).
+     - The embedded `cb` tracks positions in samples, not items, so the usual
+       lock-free SPSC rules of the core buffer apply.
+     - A byte may hold samples of both the producer and the consumer when the
+       width is not a multiple of 8. Single samples are therefore read and
+       written with relaxed byte atomics; whole groups never share a byte.
+
+     Public API:
+       - `cb_pack_init()`        : Initialize a packed ring over static storage
+       - `cb_pack_insert()`      : Insert one sample
+       - `cb_pack_remove()`      : Remove one sample
+       - `cb_pack_insert_bulk()` : Insert up to N samples
+       - `cb_pack_remove_bulk()` : Remove up to N samples
+       - `cb_pack_count()`       : Number of stored samples
+       - `cb_pack_capacity()`    : Maximum number of stored samples
+
+    @note The ring holds a multiple of 8 sample slots (rounded down from the
+         storage size), one of which stays empty as in the core buffer.
+
+    @note `ring.buf` points at the packed bytes; do not use item-level `cb_*`
+         calls such as `cb_insert()` on the embedded ring.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_PACK_H
+#define CB_PACK_H
+
+#include <stddef.h>
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Bit-packed sample ring */
+typedef struct {
+    cb ring;                        // Index bookkeeping, in samples
+    uint8_t *bytes;                 // Packed sample storage
+    size_t storage_bytes;           // Storage size in bytes
+    unsigned bits;                  // Bits per sample (1-32)
+    uint32_t mask;                  // Low `bits` bits set
+} cb_pack_t;
+
+/* Initialization */
+cb_result_t cb_pack_init(cb_pack_t *p, void *storage, size_t storage_bytes, unsigned bits);
+
+/* Single samples */
+cb_result_t cb_pack_insert(cb_pack_t *p, uint32_t sample);
+cb_result_t cb_pack_remove(cb_pack_t *p, uint32_t *sample);
+
+/* Bulk operations */
+cb_result_t cb_pack_insert_bulk(cb_pack_t *p, const uint32_t *samples, CbIndex count, CbIndex *inserted);
+cb_result_t cb_pack_remove_bulk(cb_pack_t *p, uint32_t *samples, CbIndex count, CbIndex *removed);
+
+/* Status */
+CbIndex cb_pack_count(cb_pack_t *p);
+CbIndex cb_pack_capacity(const cb_pack_t *p);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_PACK_H */
@@ -0,0 +1,276 @@
+/*
+    @file        cb_pcpu.h / cb_pcpu.c
+    @brief       Per-CPU producer rings filled through restartable sequences (Linux)
+    @details
+     - See cb_pcpu.h for the two insert paths.
+     - The critical section is described to the kernel by a `struct rseq_cs`
+       in the `__rseq_cs` section. Its abort handler sits in
+       `__rseq_failure`, right after the signature the area was registered
+       with, as the kernel requires.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // For sched_getcpu, syscall
+#endif
+
+#include "cb_pcpu.h"
+#include "cb_internal.h"
+#include <string.h>  // For memcpy, memset
+#include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && \
+    defined(__NR_rseq) && !defined(CB_PCPU_NO_RSEQ)
+#define CB_PCPU_HAS_RSEQ 1
+#include <linux/rseq.h>
+#else
+#define CB_PCPU_HAS_RSEQ 0
+#endif
+
+#if CB_PCPU_HAS_RSEQ
+
+#define CB_PCPU_RSEQ_SIG 0x53053053  // Same signature as glibc, so its area can be shared
+
+/* The critical section loads and stores the ring indices as 64-bit words */
+_Static_assert(sizeof(((cb *)0)->in) == 8 && sizeof(((cb *)0)->out) == 8,
+               "cb_pcpu rseq path expects 64-bit ring indices");
+_Static_assert(sizeof(CbItem) == 1 || sizeof(CbItem) == 2 || sizeof(CbItem) == 4 || sizeof(CbItem) == 8,
+               "cb_pcpu rseq path expects 1, 2, 4 or 8 byte items");
+
+/* Registered by glibc 2.35+; weak so that older C libraries still link */
+extern const ptrdiff_t __rseq_offset __attribute__((weak));
+extern const unsigned int __rseq_size __attribute__((weak));
+
+static __thread struct rseq cb_pcpu_own_area __attribute__((aligned(32)));
+static __thread struct rseq *cb_pcpu_area;
+static __thread int cb_pcpu_area_state;  // 0 = not resolved, 1 = usable, -1 = unavailable
+
+/* The calling thread's rseq area, registering one if nobody has */
+static struct rseq *cb_pcpu_thread_area(void) {
+    if (cb_pcpu_area_state == 0) {
+        cb_pcpu_area_state = -1;
+        if (&__rseq_size != NULL && __rseq_size > 0) {
+            cb_pcpu_area = (struct rseq *)((char *)__builtin_thread_pointer() + __rseq_offset);
+        } else if (syscall(__NR_rseq, &cb_pcpu_own_area, sizeof(cb_pcpu_own_area), 0, CB_PCPU_RSEQ_SIG) == 0) {
+            cb_pcpu_area = &cb_pcpu_own_area;
+        }
+        if (cb_pcpu_area && (int32_t)__atomic_load_n(&cb_pcpu_area->cpu_id, __ATOMIC_RELAXED) >= 0) {
+            cb_pcpu_area_state = 1;
+        }
+    }
+    return (cb_pcpu_area_state == 1) ? cb_pcpu_area : NULL;
+}
+
+/* Insert into `ring` if still running on `cpu`: 0 = stored, 1 = ring full, -1 = restarted */
+static inline int cb_pcpu_rseq_insert(struct rseq *rs, uint32_t cpu, cb *ring, CbItem item) {
+    uint64_t size = (uint64_t)ring->size;
+
+    __asm__ goto(
+        ".pushsection __rseq_cs, \"aw\"\n\t"
+        ".balign 32\n\t"
+        "3:\n\t"
+        ".long 0x0, 0x0\n\t"                    /* version, flags */
+        ".quad 1f, (2f - 1f), 4f\n\t"           /* start_ip, post_commit_offset, abort_ip */
+        ".popsection\n\t"
+        "leaq 3b(%%rip), %%rax\n\t"
+        "movq %%rax, 8(%[rs])\n\t"              /* rs->rseq_cs = &descriptor */
+        "1:\n\t"
+        "cmpl %[cpu], 4(%[rs])\n\t"             /* still on the CPU whose ring we hold? */
+        "jnz 4f\n\t"
+        "movq (%[in]), %%rcx\n\t"
+        "leaq 1(%%rcx), %%rdx\n\t"
+        "cmpq %[size], %%rdx\n\t"
+        "jb 5f\n\t"
+        "xorl %%edx, %%edx\n\t"
+        "5:\n\t"
+        "cmpq (%[out]), %%rdx\n\t"
+        "je %l[full]\n\t"
+        "mov %[item], (%[buf], %%rcx, %c[scale])\n\t"
+        "movq %%rdx, (%[in])\n\t"               /* commit */
+        "2:\n\t"
+        ".pushsection __rseq_failure, \"ax\"\n\t"
+        ".byte 0x0f, 0xb9, 0x3d\n\t"            /* ud1 opcode prefix around the signature */
+        ".long 0x53053053\n\t"
+        "4:\n\t"
+        "jmp %l[restart]\n\t"
+        ".popsection\n\t"
+        :
+        : [rs] "r"(rs), [cpu] "r"(cpu), [in] "r"(&ring->in), [out] "r"(&ring->out),
+          [size] "r"(size), [buf] "r"(ring->buf), [item] "r"(item), [scale] "i"(sizeof(CbItem))
+        : "memory", "cc", "rax", "rcx", "rdx"
+        : full, restart);
+    return 0;
+full:
+    return 1;
+restart:
+    return -1;
+}
+
+#endif /* CB_PCPU_HAS_RSEQ */
+
+cb_result_t cb_pcpu_init(cb_pcpu_t *pc, cb_pcpu_ring_t rings[], unsigned cpus,
+                         CbItem storage[], CbIndex ring_length, unsigned flags) {
+    if (!pc || !rings || !storage) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (cpus == 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    memset(pc, 0, sizeof(*pc));
+    for (unsigned i = 0; i < cpus; i++) {
+        cb_result_t result = cb_init_ex(&rings[i].ring, &storage[(size_t)i * ring_length], ring_length);
+        if (result != CB_SUCCESS) {
+            return result;
+        }
+        pthread_mutex_init(&rings[i].lock, NULL);
+    }
+    pc->rings = rings;
+    pc->cpus = cpus;
+
+#if CB_PCPU_HAS_RSEQ
+    /* A CPU without its own ring would have to share one; only the locked path allows that */
+    long configured = sysconf(_SC_NPROCESSORS_CONF);
+    pc->use_rseq = !(flags & CB_PCPU_FALLBACK) && configured > 0 && (unsigned long)configured <= cpus &&
+                   cb_pcpu_thread_area() != NULL;
+#else
+    (void)flags;
+    pc->use_rseq = false;
+#endif
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_pcpu_insert(cb_pcpu_t *pc, CbItem item) {
+    if (!pc) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+#if CB_PCPU_HAS_RSEQ
+    if (pc->use_rseq) {
+        struct rseq *rs = cb_pcpu_thread_area();
+        if (!rs) {
+            return CB_ERROR_IO;
+        }
+
+        for (;;) {
+            uint32_t cpu = __atomic_load_n(&rs->cpu_id, __ATOMIC_RELAXED);
+            int result = cb_pcpu_rseq_insert(rs, cpu, &pc->rings[cpu].ring, item);
+            if (result == 0) {
+                return CB_SUCCESS;
+            }
+            if (result > 0) {
+                return CB_ERROR_BUFFER_FULL;
+            }
+        }
+    }
+#endif
+
+    int cpu = sched_getcpu();
+    cb_pcpu_ring_t *r = &pc->rings[(cpu < 0) ? 0 : (unsigned)cpu % pc->cpus];
+
+    pthread_mutex_lock(&r->lock);
+    cb_result_t result = cb_insert_ex(&r->ring, item);
+    pthread_mutex_unlock(&r->lock);
+    return result;
+}
+
+cb_result_t cb_pcpu_collect(cb_pcpu_t *pc, CbItem *items, size_t max, size_t *collected) {
+    if (!pc || !items || !collected) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *collected = 0;
+    if (max == 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    /* Visit every ring once, starting after the one that was drained first last time */
+    size_t total = 0;
+    unsigned start = pc->cursor;
+    for (unsigned i = 0; i < pc->cpus && total < max; i++) {
+        unsigned index = (start + i) % pc->cpus;
+        cb *ring = &pc->rings[index].ring;
+        cb_span_t spans[2];
+        CbIndex available;
+
+        if (cb_get_read_spans_ex(ring, spans, &available) != CB_SUCCESS) {
+            continue;
+        }
+
+        size_t n = ((size_t)available < max - total) ? (size_t)available : max - total;
+        size_t first = (n < (size_t)spans[0].count) ? n : (size_t)spans[0].count;
+        memcpy(items + total, spans[0].data, first * sizeof(CbItem));
+        if (n > first) {
+            memcpy(items + total + first, spans[1].data, (n - first) * sizeof(CbItem));
+        }
+        cb_commit_read_ex(ring, (CbIndex)n);
+        total += n;
+    }
+    pc->cursor = (start + 1) % pc->cpus;
+
+    *collected = total;
+    return (total > 0) ? CB_SUCCESS : CB_ERROR_BUFFER_EMPTY;
+}
+
+static void *cb_pcpu_collector(void *arg) {
+    cb_pcpu_t *pc = (cb_pcpu_t *)arg;
+    CbItem items[CB_PCPU_COLLECT_BATCH];
+    size_t n;
+
+    while (!__atomic_load_n(&pc->stop, __ATOMIC_ACQUIRE)) {
+        if (cb_pcpu_collect(pc, items, CB_PCPU_COLLECT_BATCH, &n) == CB_SUCCESS) {
+            pc->fn(items, n, pc->ctx);
+        } else {
+            usleep(pc->interval_us);
+        }
+    }
+
+    /* Hand over what producers left before stop */
+    while (cb_pcpu_collect(pc, items, CB_PCPU_COLLECT_BATCH, &n) == CB_SUCCESS) {
+        pc->fn(items, n, pc->ctx);
+    }
+    return NULL;
+}
+
+cb_result_t cb_pcpu_start(cb_pcpu_t *pc, cb_pcpu_drain_fn_t fn, void *ctx, unsigned interval_us) {
+    if (!pc || !fn) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (pc->running) {
+        return CB_ERROR_INVALID_PARAMETER;
+    }
+
+    pc->fn = fn;
+    pc->ctx = ctx;
+    pc->interval_us = interval_us;
+    __atomic_store_n(&pc->stop, 0, __ATOMIC_RELEASE);
+    if (pthread_create(&pc->thread, NULL, cb_pcpu_collector, pc) != 0) {
+        return CB_ERROR_IO;
+    }
+    pc->running = true;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_pcpu_stop(cb_pcpu_t *pc) {
+    if (!pc) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (!pc->running) {
+        return CB_SUCCESS;
+    }
+
+    __atomic_store_n(&pc->stop, 1, __ATOMIC_RELEASE);
+    pthread_join(pc->thread, NULL);
+    pc->running = false;
+    return CB_SUCCESS;
+}
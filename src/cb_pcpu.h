@@ -0,0 +1,102 @@
+/*
+    @file        cb_pcpu.h / cb_pcpu.c
+    @brief       Per-CPU producer rings filled through restartable sequences (Linux)
+    @details
+     - One `cb` ring per CPU. Any number of threads insert into the ring of
+       the CPU they run on, and one collector drains all rings.
+     - On x86-64 the insert is a restartable sequence (`rseq`): the check of
+       the current CPU, the free-space check, the slot store and the `in`
+       store run as one critical section that the kernel restarts if the
+       thread is preempted or migrated. No lock and no atomic
+       read-modify-write is needed, however many threads emit.
+     - The thread's rseq area is the one glibc registered (`__rseq_offset`),
+       or one registered here with the raw `rseq` syscall when glibc did not
+       register one. No external library is used.
+     - Without rseq (other architectures, old kernels, `CB_PCPU_FALLBACK`, or
+       fewer rings than configured CPUs) every ring gets a mutex and inserts
+       go through `cb_insert_ex()`. The collector side is the same in both
+       modes.
+
+     Public API:
+       - `cb_pcpu_init()`    : Set up one ring per CPU and pick rseq or fallback
+       - `cb_pcpu_insert()`  : Insert one item into the current CPU's ring
+       - `cb_pcpu_collect()` : Drain up to N items from all rings, round-robin
+       - `cb_pcpu_start()`   : Start a collector thread that hands batches to a callback
+       - `cb_pcpu_stop()`    : Stop the collector after a final drain
+
+    @note Items from one thread stay in order only while it stays on one
+         CPU; there is no order between rings.
+
+    @note The rseq path needs an integer `CB_ITEM_TYPE` of 1, 2, 4 or 8
+         bytes and the default 64-bit `CbIndex`. Define `CB_PCPU_NO_RSEQ`
+         to build without it.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_PCPU_H
+#define CB_PCPU_H
+
+#include <stddef.h>
+#include <pthread.h>
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CB_PCPU_COLLECT_BATCH
+#define CB_PCPU_COLLECT_BATCH 1024  // Items per collector callback at most
+#endif
+
+#ifndef CB_PCPU_LINE_SIZE
+#define CB_PCPU_LINE_SIZE 64
+#endif
+
+/* cb_pcpu_init() flags */
+#define CB_PCPU_FALLBACK 0x1u       // Use the locked cb path even if rseq works
+
+/* Collector callback; items are valid during the call only */
+typedef void (*cb_pcpu_drain_fn_t)(const CbItem *items, size_t count, void *ctx);
+
+typedef struct {
+    cb ring;
+    pthread_mutex_t lock;           // Fallback path only
+    uint8_t pad[CB_PCPU_LINE_SIZE];
+} cb_pcpu_ring_t;
+
+typedef struct {
+    cb_pcpu_ring_t *rings;
+    unsigned cpus;
+    unsigned cursor;                // Collector round-robin start
+    bool use_rseq;
+
+    /* Collector thread */
+    pthread_t thread;
+    bool running;
+    uint32_t stop;
+    unsigned interval_us;           // Sleep when all rings are empty
+    cb_pcpu_drain_fn_t fn;
+    void *ctx;
+} cb_pcpu_t;
+
+cb_result_t cb_pcpu_init(cb_pcpu_t *pc, cb_pcpu_ring_t rings[], unsigned cpus,
+                         CbItem storage[], CbIndex ring_length, unsigned flags);
+
+/* Producer side, any thread */
+cb_result_t cb_pcpu_insert(cb_pcpu_t *pc, CbItem item);
+
+/* Collector side, one thread */
+cb_result_t cb_pcpu_collect(cb_pcpu_t *pc, CbItem *items, size_t max, size_t *collected);
+cb_result_t cb_pcpu_start(cb_pcpu_t *pc, cb_pcpu_drain_fn_t fn, void *ctx, unsigned interval_us);
+cb_result_t cb_pcpu_stop(cb_pcpu_t *pc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_PCPU_H */
@@ -0,0 +1,352 @@
+/*
+    @file        cb_quant.h / cb_quant.c
+    @brief       Running median and quantiles over the contents of a ring
+    @details
+     - See cb_quant.h for the data structures.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include "cb_quant.h"
+#include "cb_internal.h"
+
+/* Smallest rank r >= 1 with r >= p * n */
+static uint32_t cb_quant_nearest_rank(double p, uint32_t n) {
+    double exact = p * (double)n;
+    uint32_t rank = (uint32_t)exact;
+
+    if ((double)rank < exact) {
+        rank++;
+    }
+    return (rank == 0) ? 1u : rank;
+}
+
+/* Level for a new node: each extra level with probability 1/4 */
+static uint8_t cb_quant_height(cb_quant_t *q) {
+    uint32_t x = q->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    q->rng = x;
+
+    uint8_t height = 1;
+    while (height < CB_QUANT_LEVELS && (x & 3u) == 0) {
+        height++;
+        x >>= 2;
+    }
+    return height;
+}
+
+static void cb_quant_list_insert(cb_quant_t *q, CbItem value) {
+    cb_quant_node_t *nodes = q->nodes;
+    uint32_t chain[CB_QUANT_LEVELS];
+    uint32_t steps_at[CB_QUANT_LEVELS];
+    uint32_t node = 0;
+    uint32_t steps = 0;
+
+    /* Find the last node <= value on every level, counting positions */
+    for (int l = CB_QUANT_LEVELS - 1; l >= 0; l--) {
+        while (nodes[node].next[l] != 0 && !CB_QUANT_LESS(value, nodes[nodes[node].next[l]].value)) {
+            steps += nodes[node].width[l];
+            node = nodes[node].next[l];
+        }
+        chain[l] = node;
+        steps_at[l] = steps;
+    }
+
+    uint32_t d = q->free_list;
+    q->free_list = nodes[d].next[0];
+
+    uint8_t height = cb_quant_height(q);
+    nodes[d].value = value;
+    nodes[d].height = height;
+
+    for (int l = 0; l < CB_QUANT_LEVELS; l++) {
+        uint32_t prev = chain[l];
+        if (l < height) {
+            nodes[d].next[l] = nodes[prev].next[l];
+            nodes[prev].next[l] = d;
+            nodes[d].width[l] = nodes[prev].width[l] - (steps - steps_at[l]);
+            nodes[prev].width[l] = steps - steps_at[l] + 1;
+        } else {
+            nodes[prev].width[l]++;
+        }
+    }
+    q->size++;
+}
+
+static bool cb_quant_list_remove(cb_quant_t *q, CbItem value) {
+    cb_quant_node_t *nodes = q->nodes;
+    uint32_t chain[CB_QUANT_LEVELS];
+    uint32_t node = 0;
+
+    /* Find the last node < value on every level */
+    for (int l = CB_QUANT_LEVELS - 1; l >= 0; l--) {
+        while (nodes[node].next[l] != 0 && CB_QUANT_LESS(nodes[nodes[node].next[l]].value, value)) {
+            node = nodes[node].next[l];
+        }
+        chain[l] = node;
+    }
+
+    uint32_t d = nodes[chain[0]].next[0];
+    if (d == 0 || CB_QUANT_LESS(value, nodes[d].value)) {
+        return false;
+    }
+
+    for (int l = 0; l < CB_QUANT_LEVELS; l++) {
+        uint32_t prev = chain[l];
+        if (l < nodes[d].height) {
+            nodes[prev].width[l] += nodes[d].width[l] - 1;
+            nodes[prev].next[l] = nodes[d].next[l];
+        } else {
+            nodes[prev].width[l]--;
+        }
+    }
+
+    nodes[d].next[0] = q->free_list;
+    q->free_list = d;
+    q->size--;
+    return true;
+}
+
+static unsigned cb_quant_bucket(const cb_quant_sketch_t *sk, CbItem item) {
+    double v = CB_QUANT_VALUE(item);
+    if (v <= sk->lo) {
+        return 0;
+    }
+    if (v >= sk->hi) {
+        return sk->buckets - 1;
+    }
+    unsigned b = (unsigned)((v - sk->lo) / (sk->hi - sk->lo) * sk->buckets);
+    return (b < sk->buckets) ? b : sk->buckets - 1;
+}
+
+static void cb_quant_sketch_add(cb_quant_sketch_t *sk, CbItem item, int32_t delta) {
+    for (unsigned i = cb_quant_bucket(sk, item) + 1; i <= sk->buckets; i += i & (0u - i)) {
+        sk->tree[i - 1] += (uint32_t)delta;
+    }
+    sk->total += (uint32_t)delta;
+}
+
+static void cb_quant_track(cb_quant_t *q, CbItem item) {
+    cb_quant_list_insert(q, item);
+    if (q->sketch) {
+        cb_quant_sketch_add(q->sketch, item, 1);
+    }
+}
+
+static void cb_quant_untrack(cb_quant_t *q, CbItem item) {
+    if (cb_quant_list_remove(q, item) && q->sketch) {
+        cb_quant_sketch_add(q->sketch, item, -1);
+    }
+}
+
+cb_result_t cb_quant_sketch_init(cb_quant_sketch_t *sk, uint32_t *counts, unsigned buckets, double lo, double hi) {
+    if (!sk || !counts) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (buckets == 0 || !(lo < hi)) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    for (unsigned i = 0; i < buckets; i++) {
+        counts[i] = 0;
+    }
+
+    sk->tree = counts;
+    sk->buckets = buckets;
+    sk->lo = lo;
+    sk->hi = hi;
+    sk->total = 0;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_quant_init(cb_quant_t *q, cb *ring, cb_quant_node_t *nodes, size_t node_count,
+                          cb_quant_sketch_t *sketch) {
+    if (!q || !ring || !nodes) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (ring->size == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    /* One head node plus one node per storable item */
+    if (node_count < (size_t)ring->size || node_count > UINT32_MAX) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    q->ring = ring;
+    q->nodes = nodes;
+    q->node_count = node_count;
+    q->size = 0;
+    q->rng = 0x9E3779B9u;
+    q->sketch = sketch;
+
+    for (int l = 0; l < CB_QUANT_LEVELS; l++) {
+        nodes[0].next[l] = 0;
+        nodes[0].width[l] = 1;
+    }
+    nodes[0].height = CB_QUANT_LEVELS;
+
+    /* Chain every other node into the free list */
+    q->free_list = (node_count > 1) ? 1u : 0u;
+    for (size_t i = 1; i < node_count; i++) {
+        nodes[i].next[0] = (i + 1 < node_count) ? (uint32_t)(i + 1) : 0u;
+    }
+
+    /* Track items already stored */
+    CbIndex stored = cb_dataSize(ring);
+    for (CbIndex i = 0; i < stored; i++) {
+        CbItem item;
+        cb_peek_ex(ring, i, &item);
+        cb_quant_track(q, item);
+    }
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_quant_insert(cb_quant_t *q, CbItem item) {
+    if (!q) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    /* Remember the item that overwrite is about to evict */
+    CbItem evicted;
+    bool evicts = cb_freeSpace(q->ring) == 0 && cb_get_overwrite(q->ring) &&
+                  cb_peek_ex(q->ring, 0, &evicted) == CB_SUCCESS;
+
+    cb_result_t result = cb_insert_ex(q->ring, item);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    if (evicts) {
+        cb_quant_untrack(q, evicted);
+    }
+    cb_quant_track(q, item);
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_quant_remove(cb_quant_t *q, CbItem *item) {
+    if (!q || !item) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    cb_result_t result = cb_remove_ex(q->ring, item);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    cb_quant_untrack(q, *item);
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_quant_rank(const cb_quant_t *q, CbIndex k, CbItem *item) {
+    if (!q || !item) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (q->size == 0) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    if (k >= q->size) {
+        return CB_ERROR_INVALID_OFFSET;
+    }
+
+    const cb_quant_node_t *nodes = q->nodes;
+    uint32_t node = 0;
+    uint32_t remaining = (uint32_t)k + 1;
+
+    for (int l = CB_QUANT_LEVELS - 1; l >= 0; l--) {
+        while (nodes[node].next[l] != 0 && nodes[node].width[l] <= remaining) {
+            remaining -= nodes[node].width[l];
+            node = nodes[node].next[l];
+        }
+    }
+
+    *item = nodes[node].value;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_quant_quantile(const cb_quant_t *q, double p, CbItem *item) {
+    if (!q || !item) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (!(p >= 0.0 && p <= 1.0)) {
+        return CB_ERROR_INVALID_PARAMETER;
+    }
+
+    if (q->size == 0) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    /* Nearest rank: the smallest item with at least p * n items at or below it */
+    return cb_quant_rank(q, (CbIndex)(cb_quant_nearest_rank(p, q->size) - 1), item);
+}
+
+cb_result_t cb_quant_median(const cb_quant_t *q, CbItem *item) {
+    if (!q || !item) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (q->size == 0) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    return cb_quant_rank(q, (q->size - 1) / 2, item);
+}
+
+cb_result_t cb_quant_approx(const cb_quant_t *q, double p, double *value) {
+    if (!q || !value) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    const cb_quant_sketch_t *sk = q->sketch;
+    if (!sk) {
+        return CB_ERROR_INVALID_PARAMETER;
+    }
+
+    if (!(p >= 0.0 && p <= 1.0)) {
+        return CB_ERROR_INVALID_PARAMETER;
+    }
+
+    if (sk->total == 0) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    uint32_t rank = cb_quant_nearest_rank(p, sk->total);
+
+    /* Fenwick descent to the first bucket whose prefix count reaches rank */
+    unsigned step = 1;
+    while (step * 2 <= sk->buckets) {
+        step *= 2;
+    }
+
+    unsigned pos = 0;
+    uint32_t below = 0;
+    for (; step > 0; step /= 2) {
+        if (pos + step <= sk->buckets && below + sk->tree[pos + step - 1] < rank) {
+            pos += step;
+            below += sk->tree[pos - 1];
+        }
+    }
+
+    /* Bucket `pos` holds the target; interpolate inside it */
+    uint32_t in_bucket = 0;
+    for (unsigned i = pos + 1; i > 0; i -= i & (0u - i)) {
+        in_bucket += sk->tree[i - 1];
+    }
+    in_bucket -= below;
+
+    double width = (sk->hi - sk->lo) / sk->buckets;
+    double fraction = (in_bucket > 0) ? (double)(rank - below) / (double)in_bucket : 0.5;
+    *value = sk->lo + ((double)pos + fraction) * width;
+    return CB_SUCCESS;
+}
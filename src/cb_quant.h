@@ -0,0 +1,110 @@
+/*
+    @file        cb_quant.h / cb_quant.c
+    @brief       Running median and quantiles over the contents of a ring
+    @details
+     - Exact order statistics: an indexable skip list holds every stored item.
+       Insert, removal and rank queries are O(log n) expected, so medians and
+       percentiles are found without copying or sorting the window.
+     - Approximate quantiles: an optional fixed-bucket histogram sketch kept in
+       a Fenwick tree. Updates and queries are O(log buckets) and the error is
+       below one bucket width.
+     - Both structures follow the ring: items evicted by overwrite on insert
+       and items removed through `cb_quant_remove()` leave them as well.
+
+     Public API:
+       - `cb_quant_sketch_init()` : Initialize a histogram sketch over [lo, hi)
+       - `cb_quant_init()`        : Attach order statistics (and a sketch) to a ring
+       - `cb_quant_insert()`      : Insert an item, evicting the oldest on overwrite
+       - `cb_quant_remove()`      : Remove the oldest item
+       - `cb_quant_rank()`        : k-th smallest stored item
+       - `cb_quant_quantile()`    : Exact quantile (nearest rank)
+       - `cb_quant_median()`      : Exact (lower) median
+       - `cb_quant_approx()`      : Approximate quantile from the sketch
+
+    @note The node pool needs one node per storable item plus one head node,
+         i.e. the ring's buffer length.
+
+    @note Insert and remove through `cb_quant_*()` only. Not thread-safe:
+         calls must be serialized by the caller.
+
+    @note Items are compared with `CB_QUANT_LESS(a, b)` and converted for the
+         sketch with `CB_QUANT_VALUE(item)`; define both for non-arithmetic
+         `CB_ITEM_TYPE`s.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_QUANT_H
+#define CB_QUANT_H
+
+#include <stddef.h>
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CB_QUANT_LEVELS
+#define CB_QUANT_LEVELS 12          // Skip list levels (4^12 items at p = 1/4)
+#endif
+
+#ifndef CB_QUANT_LESS
+#define CB_QUANT_LESS(a, b) ((a) < (b))
+#endif
+
+#ifndef CB_QUANT_VALUE
+#define CB_QUANT_VALUE(item) ((double)(item))
+#endif
+
+/* Skip list node; supplied by the caller as a pool */
+typedef struct {
+    CbItem value;                   // Stored item
+    uint8_t height;                 // Levels this node takes part in
+    uint32_t next[CB_QUANT_LEVELS]; // Successor per level (0 = end)
+    uint32_t width[CB_QUANT_LEVELS];    // Items skipped by each link
+} cb_quant_node_t;
+
+/* Histogram sketch for approximate quantiles */
+typedef struct {
+    uint32_t *tree;                 // Fenwick tree of bucket counts
+    unsigned buckets;               // Number of buckets
+    double lo;                      // Lower bound of the first bucket
+    double hi;                      // Upper bound of the last bucket
+    uint32_t total;                 // Items in the sketch
+} cb_quant_sketch_t;
+
+/* Order statistics attached to a ring */
+typedef struct {
+    cb *ring;                       // Tracked ring
+    cb_quant_node_t *nodes;         // Node pool, nodes[0] is the head
+    size_t node_count;              // Nodes in the pool
+    uint32_t free_list;             // First free node (0 = none)
+    uint32_t size;                  // Items in the skip list
+    uint32_t rng;                   // Level generator state
+    cb_quant_sketch_t *sketch;      // Optional sketch (NULL = none)
+} cb_quant_t;
+
+/* Initialization */
+cb_result_t cb_quant_sketch_init(cb_quant_sketch_t *sk, uint32_t *counts, unsigned buckets, double lo, double hi);
+cb_result_t cb_quant_init(cb_quant_t *q, cb *ring, cb_quant_node_t *nodes, size_t node_count,
+                          cb_quant_sketch_t *sketch);
+
+/* Ring operations */
+cb_result_t cb_quant_insert(cb_quant_t *q, CbItem item);
+cb_result_t cb_quant_remove(cb_quant_t *q, CbItem *item);
+
+/* Queries */
+cb_result_t cb_quant_rank(const cb_quant_t *q, CbIndex k, CbItem *item);
+cb_result_t cb_quant_quantile(const cb_quant_t *q, double p, CbItem *item);
+cb_result_t cb_quant_median(const cb_quant_t *q, CbItem *item);
+cb_result_t cb_quant_approx(const cb_quant_t *q, double p, double *value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_QUANT_H */
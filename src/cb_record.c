@@ -0,0 +1,277 @@
+/*
+    @file        cb_record.h / cb_record.c
+    @brief       Variable-length record framing on top of the circular buffer
+    @details
+     - See cb_record.h for the record layout.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include "cb_record.h"
+#include "cb_internal.h"
+#include <string.h>  // For memcpy
+
+/* Record granularity in bytes: a multiple of both the header alignment and the item size */
+static size_t cb_record_unit(void) {
+    size_t a = CB_RECORD_ALIGN;
+    size_t b = sizeof(CbItem);
+
+    while (b != 0) {
+        size_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return (CB_RECORD_ALIGN / a) * sizeof(CbItem);
+}
+
+/* Copy bytes out of the ring starting at a byte position, wrapping at the end */
+static void cb_record_copy_out(const cb *cb_ptr, size_t pos, void *dst, size_t n) {
+    const uint8_t *base = (const uint8_t *)cb_ptr->buf;
+    size_t total = (size_t)cb_ptr->size * sizeof(CbItem);
+    size_t first = total - pos;
+
+    if (n <= first) {
+        memcpy(dst, base + pos, n);
+    } else {
+        memcpy(dst, base + pos, first);
+        memcpy((uint8_t *)dst + first, base, n - first);
+    }
+}
+
+/* Copy bytes into the ring starting at a byte position, wrapping at the end */
+static void cb_record_copy_in(cb *cb_ptr, size_t pos, const void *src, size_t n) {
+    uint8_t *base = (uint8_t *)cb_ptr->buf;
+    size_t total = (size_t)cb_ptr->size * sizeof(CbItem);
+    size_t first = total - pos;
+
+    if (n <= first) {
+        memcpy(base + pos, src, n);
+    } else {
+        memcpy(base + pos, src, first);
+        memcpy(base, (const uint8_t *)src + first, n - first);
+    }
+}
+
+/* Describe the payload that starts after the header of the record at an item position */
+static void cb_record_fill_view(const cb *cb_ptr, CbIndex pos, size_t length, cb_record_view_t *view) {
+    uint8_t *base = (uint8_t *)cb_ptr->buf;
+    size_t total = (size_t)cb_ptr->size * sizeof(CbItem);
+    size_t start = (size_t)pos * sizeof(CbItem) + CB_RECORD_HEADER_SIZE;
+
+    if (start >= total) {
+        start -= total;
+    }
+
+    size_t first = total - start;
+    view->data[0] = base + start;
+    view->data[1] = NULL;
+    view->length[1] = 0;
+    if (length <= first) {
+        view->length[0] = length;
+    } else {
+        view->length[0] = first;
+        view->data[1] = base;
+        view->length[1] = length - first;
+    }
+    view->size = length;
+}
+
+CbIndex cb_record_items(size_t length) {
+    size_t unit = cb_record_unit();
+    size_t bytes = CB_RECORD_HEADER_SIZE + length;
+
+    bytes = ((bytes + unit - 1) / unit) * unit;
+    return (CbIndex)(bytes / sizeof(CbItem));
+}
+
+cb_result_t cb_record_view(const cb *cb_ptr, CbIndex offset, cb_record_view_t *view) {
+    if (!cb_ptr || !view) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (cb_ptr->size == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    CbIndex current_out = CB_ATOMIC_LOAD(&cb_ptr->out);
+    CbIndex current_in = cb_internal_load_in(cb_ptr);
+    CbIndex used = cb_internal_used(current_in, current_out, cb_ptr->size);
+
+    if (offset >= used) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    if (used - offset < cb_record_items(0)) {
+        return CB_ERROR_BUFFER_CORRUPTED;
+    }
+
+    CbIndex pos = cb_internal_advance(current_out, offset, cb_ptr->size);
+    uint32_t header;
+    cb_record_copy_out(cb_ptr, (size_t)pos * sizeof(CbItem), &header, sizeof(header));
+
+    size_t length = (size_t)(header & CB_RECORD_MAX_LENGTH);
+    CbIndex items = cb_record_items(length);
+    if (items > used - offset) {
+        return CB_ERROR_BUFFER_CORRUPTED;
+    }
+
+    cb_record_fill_view(cb_ptr, pos, length, view);
+    view->items = items;
+    view->padding = (header & CB_RECORD_PAD) != 0;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_record_prepare(cb *cb_ptr, CbIndex offset, size_t length, cb_record_view_t *view) {
+    if (!cb_ptr || !view) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (cb_ptr->size == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    if (length > CB_RECORD_MAX_LENGTH) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    CbIndex current_in = CB_ATOMIC_LOAD(&cb_ptr->in);
+    CbIndex current_out = cb_internal_load_out(cb_ptr);
+    CbIndex free_slots = (cb_ptr->size - 1) - cb_internal_used(current_in, current_out, cb_ptr->size);
+    CbIndex items = cb_record_items(length);
+
+    if (offset > free_slots || items > free_slots - offset) {
+        return CB_ERROR_BUFFER_FULL;
+    }
+
+    cb_record_fill_view(cb_ptr, cb_internal_advance(current_in, offset, cb_ptr->size), length, view);
+    view->items = items;
+    view->padding = false;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_record_finish(cb *cb_ptr, CbIndex offset, size_t length, size_t reserved) {
+    if (!cb_ptr) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (cb_ptr->size == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    if (length > reserved || reserved > CB_RECORD_MAX_LENGTH) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    CbIndex current_in = CB_ATOMIC_LOAD(&cb_ptr->in);
+    CbIndex pos = cb_internal_advance(current_in, offset, cb_ptr->size);
+    uint32_t header = (uint32_t)length;
+    cb_record_copy_in(cb_ptr, (size_t)pos * sizeof(CbItem), &header, sizeof(header));
+
+    /* Turn the unused tail of the reservation into filler */
+    CbIndex items = cb_record_items(length);
+    CbIndex reserved_items = cb_record_items(reserved);
+    if (reserved_items > items) {
+        CbIndex pad_pos = cb_internal_advance(pos, items, cb_ptr->size);
+        header = CB_RECORD_PAD |
+                 (uint32_t)((size_t)(reserved_items - items) * sizeof(CbItem) - CB_RECORD_HEADER_SIZE);
+        cb_record_copy_in(cb_ptr, (size_t)pad_pos * sizeof(CbItem), &header, sizeof(header));
+    }
+
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_record_write(cb *cb_ptr, const void *data, size_t length) {
+    if (!cb_ptr) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (!data && length > 0) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    cb_record_view_t view;
+    cb_result_t result = cb_record_prepare(cb_ptr, 0, length, &view);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    if (view.length[0] > 0) {
+        memcpy(view.data[0], data, view.length[0]);
+    }
+    if (view.length[1] > 0) {
+        memcpy(view.data[1], (const uint8_t *)data + view.length[0], view.length[1]);
+    }
+
+    cb_record_finish(cb_ptr, 0, length, length);
+    return cb_commit_write_ex(cb_ptr, view.items);
+}
+
+cb_result_t cb_record_read(cb *cb_ptr, void *data, size_t capacity, size_t *length) {
+    if (!cb_ptr || !length) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (!data && capacity > 0) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *length = 0;
+
+    cb_record_view_t view;
+    CbIndex offset = 0;
+    cb_result_t result;
+
+    /* Leading filler is released together with the record */
+    while ((result = cb_record_view(cb_ptr, offset, &view)) == CB_SUCCESS && view.padding) {
+        offset += view.items;
+    }
+
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    *length = view.size;
+    if (view.size > capacity) {
+        CB_RETURN_ERROR(cb_ptr, CB_ERROR_INVALID_COUNT, "capacity");
+    }
+
+    if (view.length[0] > 0) {
+        memcpy(data, view.data[0], view.length[0]);
+    }
+    if (view.length[1] > 0) {
+        memcpy((uint8_t *)data + view.length[0], view.data[1], view.length[1]);
+    }
+
+    /* Filler that trails the record was published with it; release it too */
+    offset += view.items;
+    while (cb_record_view(cb_ptr, offset, &view) == CB_SUCCESS && view.padding) {
+        offset += view.items;
+    }
+
+    return cb_commit_read_ex(cb_ptr, offset);
+}
+
+cb_result_t cb_record_peek_length(const cb *cb_ptr, size_t *length) {
+    if (!cb_ptr || !length) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *length = 0;
+
+    cb_record_view_t view;
+    CbIndex offset = 0;
+    cb_result_t result;
+
+    while ((result = cb_record_view(cb_ptr, offset, &view)) == CB_SUCCESS && view.padding) {
+        offset += view.items;
+    }
+
+    if (result == CB_SUCCESS) {
+        *length = view.size;
+    }
+    return result;
+}
@@ -0,0 +1,76 @@
+/*
+    @file        cb_record.h / cb_record.c
+    @brief       Variable-length record framing on top of the circular buffer
+    @details
+     - A record is a 32-bit length header followed by the payload bytes,
+       padded so that the next header starts on a `CB_RECORD_ALIGN` boundary
+       and on a whole item.
+     - A header with `CB_RECORD_PAD` set marks filler that readers skip. It is
+       used when a slot reserved for a maximum-size record ends up shorter.
+     - Records are published and released with a single index update each,
+       never partially; the consumer never observes a half-written record.
+     - Views (`cb_record_view_t`) give in-place access to a record payload as
+       at most two segments, for zero-copy consumers such as socket I/O.
+
+     Public API:
+       - `cb_record_items()`       : Slots occupied by a record of a given length
+       - `cb_record_write()`       : Append one record (all or nothing)
+       - `cb_record_read()`        : Remove the oldest record into a buffer
+       - `cb_record_peek_length()` : Length of the oldest record
+       - `cb_record_view()`        : In-place view of a stored record
+       - `cb_record_prepare()`     : In-place view of a slot for a new record
+       - `cb_record_finish()`      : Write the header of a prepared record
+
+    @note Records use the raw bytes of the item storage, so any `CB_ITEM_TYPE`
+         works; with byte items nothing is wasted beyond the alignment.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_RECORD_H
+#define CB_RECORD_H
+
+#include <stddef.h>
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CB_RECORD_HEADER_SIZE 4u            // Bytes in a record header
+#define CB_RECORD_ALIGN       4u            // Record start alignment in bytes (at least)
+#define CB_RECORD_PAD         0x80000000u   // Header flag: filler, not a record
+#define CB_RECORD_MAX_LENGTH  0x7FFFFFFFu   // Largest payload a header can describe
+
+/* In-place view of a record payload */
+typedef struct {
+    void *data[2];                  // Payload segments (second is used on wrap)
+    size_t length[2];               // Bytes in each segment
+    size_t size;                    // Payload length
+    CbIndex items;                  // Slots from the record start to the next record
+    bool padding;                   // True for filler records
+} cb_record_view_t;
+
+/* Sizing */
+CbIndex cb_record_items(size_t length);
+
+/* Copying operations */
+cb_result_t cb_record_write(cb *cb_ptr, const void *data, size_t length);
+cb_result_t cb_record_read(cb *cb_ptr, void *data, size_t capacity, size_t *length);
+cb_result_t cb_record_peek_length(const cb *cb_ptr, size_t *length);
+
+/* In-place access; offsets are in items from the oldest stored item (view)
+   or from the first free slot (prepare/finish) */
+cb_result_t cb_record_view(const cb *cb_ptr, CbIndex offset, cb_record_view_t *view);
+cb_result_t cb_record_prepare(cb *cb_ptr, CbIndex offset, size_t length, cb_record_view_t *view);
+cb_result_t cb_record_finish(cb *cb_ptr, CbIndex offset, size_t length, size_t reserved);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_RECORD_H */
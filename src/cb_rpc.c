@@ -0,0 +1,325 @@
+/*
+    @file        cb_rpc.h / cb_rpc.c
+    @brief       Request/response channel over a pair of record rings (Linux)
+    @details
+     - See cb_rpc.h for the message layout and the wait protocol.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // For syscall
+#endif
+
+#include "cb_rpc.h"
+#include "cb_internal.h"
+#include <string.h>  // For memcpy
+#include <time.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define CB_RPC_RELAX() __builtin_ia32_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#define CB_RPC_RELAX() __asm__ __volatile__("yield" ::: "memory")
+#else
+#define CB_RPC_RELAX() __asm__ __volatile__("" ::: "memory")
+#endif
+
+static uint64_t cb_rpc_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/* Copy bytes into a record payload at a byte offset, across its two segments */
+static void cb_rpc_put(const cb_record_view_t *view, size_t offset, const void *src, size_t n) {
+    size_t first = 0;
+
+    if (offset < view->length[0]) {
+        first = view->length[0] - offset;
+        if (first > n) {
+            first = n;
+        }
+        memcpy((uint8_t *)view->data[0] + offset, src, first);
+        offset = view->length[0];
+    }
+    if (n > first) {
+        memcpy((uint8_t *)view->data[1] + (offset - view->length[0]), (const uint8_t *)src + first, n - first);
+    }
+}
+
+/* Copy bytes out of a record payload at a byte offset, across its two segments */
+static void cb_rpc_get(const cb_record_view_t *view, size_t offset, void *dst, size_t n) {
+    size_t first = 0;
+
+    if (offset < view->length[0]) {
+        first = view->length[0] - offset;
+        if (first > n) {
+            first = n;
+        }
+        memcpy(dst, (const uint8_t *)view->data[0] + offset, first);
+        offset = view->length[0];
+    }
+    if (n > first) {
+        memcpy((uint8_t *)dst + first, (const uint8_t *)view->data[1] + (offset - view->length[0]), n - first);
+    }
+}
+
+/* View of the oldest real record; *offset gets its item offset past any filler */
+static cb_result_t cb_rpc_oldest(const cb *cb_ptr, CbIndex *offset, cb_record_view_t *view) {
+    cb_result_t result;
+
+    *offset = 0;
+    while ((result = cb_record_view(cb_ptr, *offset, view)) == CB_SUCCESS && view->padding) {
+        *offset += view->items;
+    }
+    return result;
+}
+
+/* Take the response to `id`, dropping responses to abandoned older ids */
+static cb_result_t cb_rpc_take(cb_rpc_t *ch, uint32_t id, void *response, size_t capacity, size_t *length) {
+    for (;;) {
+        cb_record_view_t view;
+        CbIndex offset;
+        cb_result_t result = cb_rpc_oldest(ch->responses, &offset, &view);
+        if (result != CB_SUCCESS) {
+            return result;
+        }
+
+        uint32_t response_id = id - 1;
+        if (view.size >= CB_RPC_ID_SIZE) {
+            cb_rpc_get(&view, 0, &response_id, CB_RPC_ID_SIZE);
+        }
+
+        if (response_id == id) {
+            *length = view.size - CB_RPC_ID_SIZE;
+            if (*length > capacity) {
+                CB_RETURN_ERROR(ch->responses, CB_ERROR_INVALID_COUNT, "capacity");
+            }
+            if (*length > 0) {
+                cb_rpc_get(&view, CB_RPC_ID_SIZE, response, *length);
+            }
+            return cb_commit_read_ex(ch->responses, offset + view.items);
+        }
+
+        if ((int32_t)(response_id - id) > 0) {
+            /* A newer id is at the head: the awaited response was already consumed */
+            CB_RETURN_ERROR(ch->responses, CB_ERROR_INVALID_PARAMETER, "id");
+        }
+
+        cb_commit_read_ex(ch->responses, offset + view.items);
+        ch->discarded++;
+    }
+}
+
+/* Tell a parked caller that responses were published */
+static void cb_rpc_wake(cb_rpc_t *ch) {
+    __atomic_fetch_add(&ch->seq, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&ch->parked, __ATOMIC_SEQ_CST)) {
+        syscall(SYS_futex, &ch->seq, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+    }
+}
+
+cb_result_t cb_rpc_init(cb_rpc_t *ch, cb *requests, cb *responses, unsigned spin) {
+    if (!ch || !requests || !responses) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (requests == responses) {
+        CB_RETURN_ERROR(requests, CB_ERROR_INVALID_PARAMETER, "responses");
+    }
+
+    memset(ch, 0, sizeof(*ch));
+    ch->requests = requests;
+    ch->responses = responses;
+    ch->spin = (spin == 0) ? CB_RPC_SPIN_DEFAULT : spin;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_rpc_submit_batch(cb_rpc_t *ch, const void *const data[], const size_t lengths[],
+                                unsigned count, uint32_t *first_id, unsigned *submitted) {
+    if (!ch || !data || !lengths || !first_id || !submitted) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *submitted = 0;
+    *first_id = ch->next_id;
+    if (count == 0) {
+        CB_RETURN_ERROR(ch->requests, CB_ERROR_INVALID_COUNT, "count");
+    }
+
+    for (unsigned i = 0; i < count; i++) {
+        if (lengths[i] > CB_RPC_MAX_PAYLOAD) {
+            CB_RETURN_ERROR(ch->requests, CB_ERROR_INVALID_COUNT, "lengths");
+        }
+        if (!data[i] && lengths[i] > 0) {
+            return CB_ERROR_NULL_POINTER;
+        }
+    }
+
+    /* Write every request that fits, then publish them together */
+    CbIndex offset = 0;
+    unsigned n = 0;
+    for (; n < count; n++) {
+        cb_record_view_t view;
+        size_t length = CB_RPC_ID_SIZE + lengths[n];
+        if (cb_record_prepare(ch->requests, offset, length, &view) != CB_SUCCESS) {
+            break;
+        }
+
+        uint32_t id = ch->next_id + n;
+        cb_rpc_put(&view, 0, &id, CB_RPC_ID_SIZE);
+        if (lengths[n] > 0) {
+            cb_rpc_put(&view, CB_RPC_ID_SIZE, data[n], lengths[n]);
+        }
+        cb_record_finish(ch->requests, offset, length, length);
+        offset += view.items;
+    }
+
+    if (n == 0) {
+        return CB_ERROR_BUFFER_FULL;
+    }
+
+    cb_commit_write_ex(ch->requests, offset);
+    ch->next_id += n;
+    *submitted = n;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_rpc_submit(cb_rpc_t *ch, const void *data, size_t length, uint32_t *id) {
+    unsigned submitted;
+    return cb_rpc_submit_batch(ch, &data, &length, 1, id, &submitted);
+}
+
+cb_result_t cb_rpc_wait(cb_rpc_t *ch, uint32_t id, void *response, size_t capacity,
+                        size_t *length, uint64_t timeout_ns) {
+    if (!ch || !length) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (!response && capacity > 0) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *length = 0;
+    if ((int32_t)(id - ch->next_id) >= 0) {
+        CB_RETURN_ERROR(ch->responses, CB_ERROR_INVALID_PARAMETER, "id");
+    }
+
+    const bool timed = timeout_ns != CB_RPC_FOREVER;
+    const uint64_t deadline = timed ? cb_rpc_now() + timeout_ns : 0;
+    unsigned spins = 0;
+
+    for (;;) {
+        /* Sample the futex word before looking, so a wake in between is not lost */
+        uint32_t seq = __atomic_load_n(&ch->seq, __ATOMIC_ACQUIRE);
+        cb_result_t result = cb_rpc_take(ch, id, response, capacity, length);
+        if (result != CB_ERROR_BUFFER_EMPTY) {
+            return result;
+        }
+
+        if (spins < ch->spin) {
+            spins++;
+            CB_RPC_RELAX();
+            continue;
+        }
+
+        struct timespec remaining;
+        struct timespec *timeout = NULL;
+        if (timed) {
+            uint64_t now = cb_rpc_now();
+            if (now >= deadline) {
+                return CB_ERROR_TIMEOUT;
+            }
+            remaining.tv_sec = (time_t)((deadline - now) / 1000000000u);
+            remaining.tv_nsec = (long)((deadline - now) % 1000000000u);
+            timeout = &remaining;
+        }
+
+        __atomic_store_n(&ch->parked, 1, __ATOMIC_SEQ_CST);
+        syscall(SYS_futex, &ch->seq, FUTEX_WAIT_PRIVATE, seq, timeout, NULL, 0);
+        __atomic_store_n(&ch->parked, 0, __ATOMIC_RELAXED);
+        ch->parks++;
+    }
+}
+
+cb_result_t cb_rpc_call(cb_rpc_t *ch, const void *request, size_t request_length,
+                        void *response, size_t capacity, size_t *length, uint64_t timeout_ns) {
+    uint32_t id;
+    cb_result_t result = cb_rpc_submit(ch, request, request_length, &id);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+    return cb_rpc_wait(ch, id, response, capacity, length, timeout_ns);
+}
+
+cb_result_t cb_rpc_serve(cb_rpc_t *ch, cb_rpc_handler_t handler, void *ctx,
+                         unsigned max, unsigned *served) {
+    if (!ch || !handler || !served) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *served = 0;
+    if (max == 0) {
+        CB_RETURN_ERROR(ch->requests, CB_ERROR_INVALID_COUNT, "max");
+    }
+
+    uint8_t request[CB_RPC_MAX_PAYLOAD];
+    uint8_t response[CB_RPC_MAX_PAYLOAD];
+    cb_result_t result = CB_ERROR_BUFFER_EMPTY;
+    unsigned count = 0;
+
+    while (count < max) {
+        /* Only take a request when any response to it fits */
+        cb_record_view_t slot;
+        if (cb_record_prepare(ch->responses, 0, CB_RPC_ID_SIZE + CB_RPC_MAX_PAYLOAD, &slot) != CB_SUCCESS) {
+            result = CB_ERROR_BUFFER_FULL;
+            break;
+        }
+
+        cb_record_view_t view;
+        CbIndex offset;
+        if (cb_rpc_oldest(ch->requests, &offset, &view) != CB_SUCCESS) {
+            break;
+        }
+
+        size_t length = view.size;
+        if (length < CB_RPC_ID_SIZE || length > CB_RPC_ID_SIZE + CB_RPC_MAX_PAYLOAD) {
+            /* Not written by cb_rpc_submit_batch(); drop it */
+            cb_commit_read_ex(ch->requests, offset + view.items);
+            continue;
+        }
+
+        uint32_t id;
+        length -= CB_RPC_ID_SIZE;
+        cb_rpc_get(&view, 0, &id, CB_RPC_ID_SIZE);
+        cb_rpc_get(&view, CB_RPC_ID_SIZE, request, length);
+        cb_commit_read_ex(ch->requests, offset + view.items);
+
+        size_t answer = handler(request, length, response, sizeof(response), ctx);
+        if (answer > sizeof(response)) {
+            answer = sizeof(response);
+        }
+
+        /* Publish each response at once; a spinning caller picks it up without a wake */
+        cb_rpc_put(&slot, 0, &id, CB_RPC_ID_SIZE);
+        cb_rpc_put(&slot, CB_RPC_ID_SIZE, response, answer);
+        cb_record_finish(ch->responses, 0, CB_RPC_ID_SIZE + answer, CB_RPC_ID_SIZE + answer);
+        cb_commit_write_ex(ch->responses, cb_record_items(CB_RPC_ID_SIZE + answer));
+        count++;
+    }
+
+    if (count == 0) {
+        return result;
+    }
+
+    cb_rpc_wake(ch);
+    *served = count;
+    return CB_SUCCESS;
+}
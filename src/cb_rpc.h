@@ -0,0 +1,99 @@
+/*
+    @file        cb_rpc.h / cb_rpc.c
+    @brief       Request/response channel over a pair of record rings (Linux)
+    @details
+     - Requests travel on one ring and responses on the other, both as
+       `cb_record` records whose payload starts with a 32-bit correlation id.
+       Ids are handed out by the caller in submission order.
+     - `cb_rpc_submit_batch()` writes several requests and publishes them with
+       one index update, so the worker sees the whole batch at once.
+     - `cb_rpc_serve()` runs a handler on up to N requests and writes each
+       response with the request's id. It only takes a request when a
+       maximum-size response fits, so a request is never lost to a full
+       response ring.
+     - `cb_rpc_wait()` polls the response ring `spin` times and then parks on
+       a futex. The worker wakes it once per served batch, and only when the
+       caller is actually parked, so the spinning fast path costs no syscall
+       on either side.
+     - Responses to ids older than the awaited one belong to calls the caller
+       gave up on (timeout); they are dropped and counted in `discarded`.
+
+     Public API:
+       - `cb_rpc_init()`         : Bind a channel to its request and response rings
+       - `cb_rpc_submit()`       : Queue one request, return its id
+       - `cb_rpc_submit_batch()` : Queue several requests with one publish
+       - `cb_rpc_wait()`         : Wait for the response to an id (spin, then park)
+       - `cb_rpc_call()`         : Submit and wait
+       - `cb_rpc_serve()`        : Worker side: answer up to N requests
+
+    @note One caller thread and one worker thread per channel. The worker
+         processes requests in order, so the caller must wait for ids in the
+         order it submitted them.
+
+    @note Payloads are limited to `CB_RPC_MAX_PAYLOAD` bytes in both
+         directions; `cb_rpc_serve()` keeps its buffers on the stack.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_RPC_H
+#define CB_RPC_H
+
+#include <stddef.h>
+#include "cb.h"
+#include "cb_record.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CB_RPC_MAX_PAYLOAD
+#define CB_RPC_MAX_PAYLOAD 1024     // Largest request or response payload in bytes
+#endif
+
+#ifndef CB_RPC_SPIN_DEFAULT
+#define CB_RPC_SPIN_DEFAULT 4096    // Response ring polls before parking when 0 is passed
+#endif
+
+#define CB_RPC_ID_SIZE 4u           // Correlation id bytes in front of every payload
+#define CB_RPC_FOREVER UINT64_MAX   // Timeout meaning "wait until answered"
+
+/* Worker handler: answer one request, return the response length */
+typedef size_t (*cb_rpc_handler_t)(const void *request, size_t length,
+                                   void *response, size_t capacity, void *ctx);
+
+typedef struct {
+    cb *requests;                   // Caller -> worker
+    cb *responses;                  // Worker -> caller
+    uint32_t next_id;               // Id of the next submitted request
+    unsigned spin;                  // Polls before parking
+    uint32_t seq;                   // Bumped by the worker after each served batch (futex word)
+    uint32_t parked;                // Non-zero while the caller sleeps on `seq`
+    uint64_t parks;                 // Times the caller went to sleep
+    uint64_t discarded;             // Stale responses dropped by cb_rpc_wait()
+} cb_rpc_t;
+
+cb_result_t cb_rpc_init(cb_rpc_t *ch, cb *requests, cb *responses, unsigned spin);
+
+/* Caller side */
+cb_result_t cb_rpc_submit(cb_rpc_t *ch, const void *data, size_t length, uint32_t *id);
+cb_result_t cb_rpc_submit_batch(cb_rpc_t *ch, const void *const data[], const size_t lengths[],
+                                unsigned count, uint32_t *first_id, unsigned *submitted);
+cb_result_t cb_rpc_wait(cb_rpc_t *ch, uint32_t id, void *response, size_t capacity,
+                        size_t *length, uint64_t timeout_ns);
+cb_result_t cb_rpc_call(cb_rpc_t *ch, const void *request, size_t request_length,
+                        void *response, size_t capacity, size_t *length, uint64_t timeout_ns);
+
+/* Worker side */
+cb_result_t cb_rpc_serve(cb_rpc_t *ch, cb_rpc_handler_t handler, void *ctx,
+                         unsigned max, unsigned *served);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_RPC_H */
@@ -0,0 +1,314 @@
+/*
+    @file        cb_soa.h / cb_soa.c
+    @brief       Columnar (struct-of-arrays) ring: one in/out pair over several column arrays
+    @details
+     - See cb_soa.h for the column layout.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include "cb_soa.h"
+#include "cb_internal.h"
+#include <string.h>  // For memcpy
+
+static uint8_t *cb_soa_cell(const cb_soa_t *s, unsigned column, CbIndex row) {
+    return s->data[column] + (size_t)row * s->width[column];
+}
+
+/* Copy n rows of one column out of the ring starting at row pos */
+static void cb_soa_copy_out(const cb_soa_t *s, unsigned column, CbIndex pos, void *dst, CbIndex n) {
+    CbIndex first = s->ring.size - pos;
+    size_t width = s->width[column];
+
+    if (n <= first) {
+        memcpy(dst, cb_soa_cell(s, column, pos), (size_t)n * width);
+    } else {
+        memcpy(dst, cb_soa_cell(s, column, pos), (size_t)first * width);
+        memcpy((uint8_t *)dst + (size_t)first * width, s->data[column], (size_t)(n - first) * width);
+    }
+}
+
+/* Copy n rows of one column into the ring starting at row pos */
+static void cb_soa_copy_in(cb_soa_t *s, unsigned column, CbIndex pos, const void *src, CbIndex n) {
+    CbIndex first = s->ring.size - pos;
+    size_t width = s->width[column];
+
+    if (n <= first) {
+        memcpy(cb_soa_cell(s, column, pos), src, (size_t)n * width);
+    } else {
+        memcpy(cb_soa_cell(s, column, pos), src, (size_t)first * width);
+        memcpy(s->data[column], (const uint8_t *)src + (size_t)first * width, (size_t)(n - first) * width);
+    }
+}
+
+/* Split n rows starting at row pos into at most two spans of one column */
+static void cb_soa_fill_spans(const cb_soa_t *s, unsigned column, CbIndex pos, CbIndex n,
+                              cb_soa_span_t spans[2]) {
+    CbIndex first = s->ring.size - pos;
+
+    spans[0].data = cb_soa_cell(s, column, pos);
+    spans[0].count = (n < first) ? n : first;
+    if (n > first) {
+        spans[1].data = s->data[column];
+        spans[1].count = n - first;
+    }
+}
+
+cb_result_t cb_soa_init(cb_soa_t *s, CbIndex length, unsigned columns,
+                        void *const data[], const size_t widths[]) {
+    if (!s || !data || !widths) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (columns == 0 || columns > CB_SOA_MAX_COLUMNS) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    for (unsigned c = 0; c < columns; c++) {
+        if (!data[c]) {
+            return CB_ERROR_NULL_POINTER;
+        }
+        if (widths[c] == 0) {
+            return CB_ERROR_INVALID_SIZE;
+        }
+    }
+
+    /* The embedded ring only tracks rows; its buffer is never dereferenced */
+    cb_result_t result = cb_init_ex(&s->ring, (CbItem *)data[0], length);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    s->columns = columns;
+    for (unsigned c = 0; c < columns; c++) {
+        s->data[c] = (uint8_t *)data[c];
+        s->width[c] = widths[c];
+    }
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_soa_push(cb_soa_t *s, const void *const fields[]) {
+    if (!s || !fields) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    for (unsigned c = 0; c < s->columns; c++) {
+        if (!fields[c]) {
+            return CB_ERROR_NULL_POINTER;
+        }
+    }
+
+    CbIndex inserted;
+    return cb_soa_insert_bulk(s, fields, 1, &inserted);
+}
+
+cb_result_t cb_soa_pop(cb_soa_t *s, void *const fields[]) {
+    if (!s || !fields) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    CbIndex removed;
+    return cb_soa_remove_bulk(s, fields, 1, &removed);
+}
+
+cb_result_t cb_soa_insert_bulk(cb_soa_t *s, const void *const columns[], CbIndex count, CbIndex *inserted) {
+    if (!s || !columns || !inserted) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *inserted = 0;
+
+    if (s->ring.size == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    if (count == 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    for (unsigned c = 0; c < s->columns; c++) {
+        if (!columns[c]) {
+            return CB_ERROR_NULL_POINTER;
+        }
+    }
+
+    CbIndex current_in = CB_ATOMIC_LOAD(&s->ring.in);
+    CbIndex current_out = cb_internal_load_out(&s->ring);
+    CbIndex free_rows = (s->ring.size - 1) - cb_internal_used(current_in, current_out, s->ring.size);
+
+    if (free_rows == 0) {
+        return CB_ERROR_BUFFER_FULL;
+    }
+
+    CbIndex n = (count < free_rows) ? count : free_rows;
+    for (unsigned c = 0; c < s->columns; c++) {
+        cb_soa_copy_in(s, c, current_in, columns[c], n);
+    }
+
+    /* All columns of the batch become visible with one index update */
+    cb_commit_write_ex(&s->ring, n);
+    *inserted = n;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_soa_remove_bulk(cb_soa_t *s, void *const columns[], CbIndex count, CbIndex *removed) {
+    if (!s || !columns || !removed) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *removed = 0;
+
+    if (s->ring.size == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    if (count == 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    CbIndex current_out = CB_ATOMIC_LOAD(&s->ring.out);
+    CbIndex current_in = cb_internal_load_in(&s->ring);
+    CbIndex used = cb_internal_used(current_in, current_out, s->ring.size);
+
+    if (used == 0) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    CbIndex n = (count < used) ? count : used;
+    for (unsigned c = 0; c < s->columns; c++) {
+        if (columns[c]) {
+            cb_soa_copy_out(s, c, current_out, columns[c], n);
+        }
+    }
+
+    cb_commit_read_ex(&s->ring, n);
+    *removed = n;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_soa_read_column(cb_soa_t *s, unsigned column, CbIndex offset,
+                               void *dst, CbIndex count, CbIndex *copied) {
+    if (!s || !dst || !copied) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *copied = 0;
+
+    if (s->ring.size == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    if (column >= s->columns) {
+        CB_RETURN_ERROR(&s->ring, CB_ERROR_INVALID_COUNT, "column");
+    }
+
+    if (count == 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    CbIndex current_out = CB_ATOMIC_LOAD(&s->ring.out);
+    CbIndex current_in = cb_internal_load_in(&s->ring);
+    CbIndex used = cb_internal_used(current_in, current_out, s->ring.size);
+
+    if (offset >= used) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    CbIndex n = used - offset;
+    if (n > count) {
+        n = count;
+    }
+
+    cb_soa_copy_out(s, column, cb_internal_advance(current_out, offset, s->ring.size), dst, n);
+    *copied = n;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_soa_get_read_spans(cb_soa_t *s, unsigned column, cb_soa_span_t spans[2], CbIndex *available) {
+    if (!s || !spans || !available) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    spans[0].data = NULL;
+    spans[0].count = 0;
+    spans[1].data = NULL;
+    spans[1].count = 0;
+    *available = 0;
+
+    if (s->ring.size == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    if (column >= s->columns) {
+        CB_RETURN_ERROR(&s->ring, CB_ERROR_INVALID_COUNT, "column");
+    }
+
+    CbIndex current_out = CB_ATOMIC_LOAD(&s->ring.out);
+    CbIndex current_in = cb_internal_load_in(&s->ring);
+    CbIndex used = cb_internal_used(current_in, current_out, s->ring.size);
+
+    if (used == 0) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    cb_soa_fill_spans(s, column, current_out, used, spans);
+    *available = used;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_soa_get_write_spans(cb_soa_t *s, unsigned column, cb_soa_span_t spans[2], CbIndex *available) {
+    if (!s || !spans || !available) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    spans[0].data = NULL;
+    spans[0].count = 0;
+    spans[1].data = NULL;
+    spans[1].count = 0;
+    *available = 0;
+
+    if (s->ring.size == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    if (column >= s->columns) {
+        CB_RETURN_ERROR(&s->ring, CB_ERROR_INVALID_COUNT, "column");
+    }
+
+    CbIndex current_in = CB_ATOMIC_LOAD(&s->ring.in);
+    CbIndex current_out = cb_internal_load_out(&s->ring);
+    CbIndex free_rows = (s->ring.size - 1) - cb_internal_used(current_in, current_out, s->ring.size);
+
+    if (free_rows == 0) {
+        return CB_ERROR_BUFFER_FULL;
+    }
+
+    cb_soa_fill_spans(s, column, current_in, free_rows, spans);
+    *available = free_rows;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_soa_commit_read(cb_soa_t *s, CbIndex count) {
+    if (!s) {
+        return CB_ERROR_NULL_POINTER;
+    }
+    return cb_commit_read_ex(&s->ring, count);
+}
+
+cb_result_t cb_soa_commit_write(cb_soa_t *s, CbIndex count) {
+    if (!s) {
+        return CB_ERROR_NULL_POINTER;
+    }
+    return cb_commit_write_ex(&s->ring, count);
+}
+
+CbIndex cb_soa_count(cb_soa_t *s) {
+    if (!s) {
+        return 0;
+    }
+    return cb_dataSize(&s->ring);
+}
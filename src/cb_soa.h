@@ -0,0 +1,91 @@
+/*
+    @file        cb_soa.h / cb_soa.c
+    @brief       Columnar (struct-of-arrays) ring: one in/out pair over several column arrays
+    @details
+     - Each field of a record lives in its own caller-supplied column array.
+       Row `r` of the ring is element `r` of every column.
+     - One `in`/`out` pair, held in the embedded `cb`, governs all columns, so
+       rows are published and retired as a whole.
+     - Consumers that need only one or two fields read those columns with
+       `cb_soa_read_column()` or read spans and commit once, streaming only
+       those columns through the cache with unit stride.
+
+     Public API:
+       - `cb_soa_init()`             : Initialize a columnar ring over column arrays
+       - `cb_soa_push()`             : Insert one row from per-field pointers
+       - `cb_soa_pop()`              : Remove one row, copying the requested fields
+       - `cb_soa_insert_bulk()`      : Insert up to N rows from column arrays
+       - `cb_soa_remove_bulk()`      : Remove up to N rows into column arrays
+       - `cb_soa_read_column()`      : Copy one column of stored rows without removing them
+       - `cb_soa_get_read_spans()`   : Contiguous regions of one column holding rows
+       - `cb_soa_get_write_spans()`  : Contiguous regions of one column that are free
+       - `cb_soa_commit_read()`      : Retire rows read through spans
+       - `cb_soa_commit_write()`     : Publish rows written through spans
+       - `cb_soa_count()`            : Number of stored rows
+
+    @note Lock-free for a single producer and a single consumer, like the core
+         buffer. Pointer arrays with a NULL entry skip that column on pop/remove.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_SOA_H
+#define CB_SOA_H
+
+#include <stddef.h>
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CB_SOA_MAX_COLUMNS
+#define CB_SOA_MAX_COLUMNS 16       // Columns per ring
+#endif
+
+/* Contiguous region of one column */
+typedef struct {
+    void *data;                     // First element of the region
+    CbIndex count;                  // Rows in the region
+} cb_soa_span_t;
+
+/* Columnar ring */
+typedef struct {
+    cb ring;                        // Row indices shared by all columns
+    unsigned columns;               // Number of columns
+    uint8_t *data[CB_SOA_MAX_COLUMNS];  // Column arrays
+    size_t width[CB_SOA_MAX_COLUMNS];   // Element size of each column in bytes
+} cb_soa_t;
+
+/* Initialization */
+cb_result_t cb_soa_init(cb_soa_t *s, CbIndex length, unsigned columns,
+                        void *const data[], const size_t widths[]);
+
+/* Row operations */
+cb_result_t cb_soa_push(cb_soa_t *s, const void *const fields[]);
+cb_result_t cb_soa_pop(cb_soa_t *s, void *const fields[]);
+
+/* Bulk operations */
+cb_result_t cb_soa_insert_bulk(cb_soa_t *s, const void *const columns[], CbIndex count, CbIndex *inserted);
+cb_result_t cb_soa_remove_bulk(cb_soa_t *s, void *const columns[], CbIndex count, CbIndex *removed);
+cb_result_t cb_soa_read_column(cb_soa_t *s, unsigned column, CbIndex offset,
+                               void *dst, CbIndex count, CbIndex *copied);
+
+/* Zero-copy access */
+cb_result_t cb_soa_get_read_spans(cb_soa_t *s, unsigned column, cb_soa_span_t spans[2], CbIndex *available);
+cb_result_t cb_soa_get_write_spans(cb_soa_t *s, unsigned column, cb_soa_span_t spans[2], CbIndex *available);
+cb_result_t cb_soa_commit_read(cb_soa_t *s, CbIndex count);
+cb_result_t cb_soa_commit_write(cb_soa_t *s, CbIndex count);
+
+/* Status */
+CbIndex cb_soa_count(cb_soa_t *s);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_SOA_H */
@@ -0,0 +1,281 @@
+/*
+    @file        cb_splice.h / cb_splice.c
+    @brief       Zero-copy export of circular buffer contents into pipes (Linux)
+    @details
+     - See cb_splice.h for the acknowledgement scheme and usage constraints.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // For vmsplice/splice
+#endif
+
+#include "cb_splice.h"
+#include "cb_internal.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+/* Release whole items covered by the first `bytes` exported bytes */
+static CbIndex cb_splice_release(cb_splice_t *sp, size_t bytes) {
+    CbIndex items = (CbIndex)(bytes / sizeof(CbItem));
+
+    if (items == 0) {
+        return 0;
+    }
+
+    if (cb_commit_read_ex(&sp->ring, items) != CB_SUCCESS) {
+        return 0;
+    }
+
+    sp->exported_bytes -= (size_t)items * sizeof(CbItem);
+    if (sp->exported_bytes == 0) {
+        sp->pipe_fd = -1;
+    }
+    return items;
+}
+
+cb_result_t cb_splice_create(cb_splice_t *sp, CbIndex bufferLength) {
+    if (!sp) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    sp->map_length = 0;
+    sp->exported_bytes = 0;
+    sp->pipe_fd = -1;
+
+    if (bufferLength < 2) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    /* Round the storage up to whole pages and use all of it */
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t bytes = (size_t)bufferLength * sizeof(CbItem);
+    size_t length = ((bytes + page - 1) / page) * page;
+
+    void *storage = mmap(NULL, length, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (storage == MAP_FAILED) {
+        return CB_ERROR_IO;
+    }
+
+    cb_result_t result = cb_init_ex(&sp->ring, (CbItem *)storage, (CbIndex)(length / sizeof(CbItem)));
+    if (result != CB_SUCCESS) {
+        munmap(storage, length);
+        return result;
+    }
+
+    sp->map_length = length;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_splice_destroy(cb_splice_t *sp) {
+    if (!sp) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (sp->map_length == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    /* The pipe may still reference exported pages; unmapping only drops our mapping */
+    munmap(sp->ring.buf, sp->map_length);
+    sp->ring.buf = NULL;
+    sp->ring.size = 0;
+    sp->map_length = 0;
+    sp->exported_bytes = 0;
+    sp->pipe_fd = -1;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_splice_export(cb_splice_t *sp, int pipe_fd, size_t max_bytes, size_t *exported) {
+    if (!sp || !exported) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *exported = 0;
+
+    if (sp->map_length == 0) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    if (max_bytes == 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    /* Reclaim accounting only works for a single pipe at a time */
+    if (pipe_fd < 0 || (sp->exported_bytes > 0 && sp->pipe_fd != pipe_fd)) {
+        CB_RETURN_ERROR(&sp->ring, CB_ERROR_INVALID_PARAMETER, "pipe_fd");
+    }
+
+    cb_span_t spans[2];
+    CbIndex available;
+    cb_result_t result = cb_get_read_spans_ex(&sp->ring, spans, &available);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    /* Skip bytes already sitting in the pipe */
+    struct iovec iov[2];
+    int iov_count = 0;
+    size_t skip = sp->exported_bytes;
+    size_t budget = max_bytes;
+
+    for (int i = 0; i < 2 && budget > 0; i++) {
+        size_t len = (size_t)spans[i].count * sizeof(CbItem);
+
+        if (skip >= len) {
+            skip -= len;
+            continue;
+        }
+
+        len -= skip;
+        if (len > budget) {
+            len = budget;
+        }
+
+        iov[iov_count].iov_base = (char *)spans[i].data + skip;
+        iov[iov_count].iov_len = len;
+        iov_count++;
+        budget -= len;
+        skip = 0;
+    }
+
+    if (iov_count == 0) {
+        return CB_ERROR_BUFFER_EMPTY;
+    }
+
+    ssize_t moved = vmsplice(pipe_fd, iov, (unsigned long)iov_count, SPLICE_F_NONBLOCK);
+    if (moved < 0) {
+        if (errno == EAGAIN) {
+            /* Pipe is full; the reader has to drain it first */
+            return CB_ERROR_BUFFER_FULL;
+        }
+        CB_RETURN_ERROR(&sp->ring, CB_ERROR_IO, "pipe_fd");
+    }
+
+    sp->exported_bytes += (size_t)moved;
+    sp->pipe_fd = pipe_fd;
+    *exported = (size_t)moved;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_splice_reclaim(cb_splice_t *sp, CbIndex *released) {
+    if (!sp || !released) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *released = 0;
+
+    if (sp->exported_bytes == 0) {
+        return CB_SUCCESS;
+    }
+
+    int unread = 0;
+    if (ioctl(sp->pipe_fd, FIONREAD, &unread) < 0) {
+        CB_RETURN_ERROR(&sp->ring, CB_ERROR_IO, "pipe_fd");
+    }
+
+    /* Everything exported minus what is still queued has left the pipe */
+    size_t pending = (size_t)unread;
+    if (pending >= sp->exported_bytes) {
+        return CB_SUCCESS;
+    }
+
+    *released = cb_splice_release(sp, sp->exported_bytes - pending);
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_splice_ack(cb_splice_t *sp, size_t bytes, CbIndex *released) {
+    if (!sp || !released) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *released = 0;
+
+    if (bytes > sp->exported_bytes) {
+        CB_RETURN_ERROR(&sp->ring, CB_ERROR_INVALID_COUNT, "bytes");
+    }
+
+    *released = cb_splice_release(sp, bytes);
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_splice_pipe_to_fd(int pipe_read_fd, int out_fd, size_t max_bytes, size_t *moved) {
+    if (!moved) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *moved = 0;
+
+    if (pipe_read_fd < 0 || out_fd < 0) {
+        return CB_ERROR_INVALID_PARAMETER;
+    }
+
+    while (*moved < max_bytes) {
+        ssize_t n = splice(pipe_read_fd, NULL, out_fd, NULL, max_bytes - *moved,
+                           SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+        if (n > 0) {
+            *moved += (size_t)n;
+        } else if (n == 0 || errno == EAGAIN) {
+            /* Pipe drained */
+            break;
+        } else if (errno != EINTR) {
+            return (*moved > 0) ? CB_SUCCESS : CB_ERROR_IO;
+        }
+    }
+
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_splice_to_fd(cb_splice_t *sp, int pipe_fd, int pipe_read_fd, int out_fd, size_t max_bytes, size_t *written) {
+    if (!sp || !written) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *written = 0;
+
+    if (max_bytes == 0) {
+        return CB_ERROR_INVALID_COUNT;
+    }
+
+    cb_result_t last_error = CB_SUCCESS;
+
+    while (*written < max_bytes) {
+        size_t exported = 0;
+        size_t moved = 0;
+        CbIndex released = 0;
+
+        cb_result_t result = cb_splice_export(sp, pipe_fd, max_bytes - *written, &exported);
+        if (result != CB_SUCCESS && result != CB_ERROR_BUFFER_FULL) {
+            last_error = result;
+            if (sp->exported_bytes == 0) {
+                break;
+            }
+        }
+
+        /* Drain everything queued, including bytes from earlier exports */
+        result = cb_splice_pipe_to_fd(pipe_read_fd, out_fd, sp->exported_bytes, &moved);
+        if (result != CB_SUCCESS) {
+            last_error = result;
+            break;
+        }
+        *written += moved;
+
+        cb_splice_reclaim(sp, &released);
+
+        if (exported == 0 && moved == 0) {
+            break;
+        }
+    }
+
+    return (*written > 0) ? CB_SUCCESS : last_error;
+}
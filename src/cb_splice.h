@@ -0,0 +1,75 @@
+/*
+    @file        cb_splice.h / cb_splice.c
+    @brief       Zero-copy export of circular buffer contents into pipes (Linux)
+    @details
+     - The library allocates page-aligned storage for the ring (`mmap`).
+     - Used segments are handed to a pipe with `vmsplice`, so the kernel
+       references the ring pages instead of copying them.
+     - Exported items stay occupied in the ring until acknowledged: either
+       explicitly via `cb_splice_ack()` or by `cb_splice_reclaim()`, which asks
+       the pipe how many exported bytes are still unread (`FIONREAD`).
+     - `cb_splice_pipe_to_fd()` moves pipe contents to a file with `splice`,
+       so ring -> pipe -> file never copies through user space.
+
+     Public API:
+       - `cb_splice_create()`     : Allocate page-aligned ring storage
+       - `cb_splice_destroy()`    : Release the storage
+       - `cb_splice_export()`     : vmsplice unexported items into a pipe (write end)
+       - `cb_splice_reclaim()`    : Release items the pipe reader has consumed
+       - `cb_splice_ack()`        : Release items acknowledged by the caller
+       - `cb_splice_pipe_to_fd()` : splice pipe contents (read end) into a file
+       - `cb_splice_to_fd()`      : Export, splice and reclaim in one call
+
+    @note The producer keeps using the embedded `ring` through the normal cb API.
+         The exporter is the ring's only consumer and the only writer of the
+         pipe; otherwise `FIONREAD` based reclaim cannot attribute bytes and
+         `cb_splice_ack()` must be used instead.
+
+    @note The reclaim scheme is safe when the pipe reader copies the data out
+         (`read`, or `splice` into a regular file). Readers that keep page
+         references after draining the pipe (e.g. zero-copy sockets) must
+         acknowledge explicitly once their transmission is complete.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_SPLICE_H
+#define CB_SPLICE_H
+
+#include <stddef.h>
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Splice-capable buffer */
+typedef struct {
+    cb ring;                        // Ring over library-allocated pages
+    size_t map_length;              // Bytes mapped for the storage
+    size_t exported_bytes;          // Bytes handed to the pipe, not yet released
+    int pipe_fd;                    // Pipe that holds the exported bytes (-1 if none)
+} cb_splice_t;
+
+/* Lifetime */
+cb_result_t cb_splice_create(cb_splice_t *sp, CbIndex bufferLength);
+cb_result_t cb_splice_destroy(cb_splice_t *sp);
+
+/* Export and acknowledgement */
+cb_result_t cb_splice_export(cb_splice_t *sp, int pipe_fd, size_t max_bytes, size_t *exported);
+cb_result_t cb_splice_reclaim(cb_splice_t *sp, CbIndex *released);
+cb_result_t cb_splice_ack(cb_splice_t *sp, size_t bytes, CbIndex *released);
+
+/* Pipe to file */
+cb_result_t cb_splice_pipe_to_fd(int pipe_read_fd, int out_fd, size_t max_bytes, size_t *moved);
+cb_result_t cb_splice_to_fd(cb_splice_t *sp, int pipe_fd, int pipe_read_fd, int out_fd, size_t max_bytes, size_t *written);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_SPLICE_H */
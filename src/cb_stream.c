@@ -0,0 +1,125 @@
+/*
+    @file        cb_stream.h / cb_stream.c
+    @brief       Bulk insert with non-temporal (streaming) stores for recorder rings
+    @details
+     - See cb_stream.h for the mode selection.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include "cb_stream.h"
+#include "cb_internal.h"
+#include <string.h>  // For memcpy
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define CB_STREAM_HAS_NT 1
+    #include <immintrin.h>
+#else
+    #define CB_STREAM_HAS_NT 0
+#endif
+
+#if CB_STREAM_HAS_NT
+/* Copy with 16-byte streaming stores; unaligned head and tail go through memcpy */
+__attribute__((target("sse2")))
+static void cb_stream_copy_nt(void *dst, const void *src, size_t bytes) {
+    uint8_t *d = (uint8_t *)dst;
+    const uint8_t *s = (const uint8_t *)src;
+
+    size_t head = (size_t)(-(uintptr_t)d & 15u);
+    if (head > bytes) {
+        head = bytes;
+    }
+    memcpy(d, s, head);
+    d += head;
+    s += head;
+    bytes -= head;
+
+    for (; bytes >= 64; bytes -= 64, d += 64, s += 64) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(s + 0));
+        __m128i b = _mm_loadu_si128((const __m128i *)(s + 16));
+        __m128i c = _mm_loadu_si128((const __m128i *)(s + 32));
+        __m128i e = _mm_loadu_si128((const __m128i *)(s + 48));
+        _mm_stream_si128((__m128i *)(d + 0), a);
+        _mm_stream_si128((__m128i *)(d + 16), b);
+        _mm_stream_si128((__m128i *)(d + 32), c);
+        _mm_stream_si128((__m128i *)(d + 48), e);
+    }
+    for (; bytes >= 16; bytes -= 16, d += 16, s += 16) {
+        _mm_stream_si128((__m128i *)d, _mm_loadu_si128((const __m128i *)s));
+    }
+    memcpy(d, s, bytes);
+}
+
+__attribute__((target("sse2")))
+static void cb_stream_fence(void) {
+    _mm_sfence();
+}
+#endif
+
+bool cb_stream_supported(void) {
+#if CB_STREAM_HAS_NT
+    static int supported = -1;
+
+    if (supported < 0) {
+        __builtin_cpu_init();
+        supported = __builtin_cpu_supports("sse2") ? 1 : 0;
+    }
+    return supported == 1;
+#else
+    return false;
+#endif
+}
+
+cb_result_t cb_stream_insert_bulk(cb *cb_ptr, const CbItem *items, CbIndex count,
+                                  cb_stream_mode_t mode, CbIndex *inserted) {
+    if (!cb_ptr || !items || !inserted) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *inserted = 0;
+    if (count == 0) {
+        CB_RETURN_ERROR(cb_ptr, CB_ERROR_INVALID_COUNT, "count");
+    }
+
+    cb_span_t spans[2];
+    CbIndex available;
+    cb_result_t result = cb_get_write_spans_ex(cb_ptr, spans, &available);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    CbIndex n = (count < available) ? count : available;
+    size_t bytes = (size_t)n * sizeof(CbItem);
+    bool stream = (mode == CB_STREAM_NONTEMPORAL) ||
+                  (mode == CB_STREAM_AUTO && bytes >= CB_STREAM_THRESHOLD);
+    stream = stream && cb_stream_supported();
+
+    CbIndex first = (n < spans[0].count) ? n : spans[0].count;
+    if (stream) {
+#if CB_STREAM_HAS_NT
+        cb_stream_copy_nt(spans[0].data, items, (size_t)first * sizeof(CbItem));
+        if (n > first) {
+            cb_stream_copy_nt(spans[1].data, items + first, (size_t)(n - first) * sizeof(CbItem));
+        }
+        /* Streaming stores are weakly ordered: drain them before publishing */
+        cb_stream_fence();
+#endif
+    } else {
+        memcpy(spans[0].data, items, (size_t)first * sizeof(CbItem));
+        if (n > first) {
+            memcpy(spans[1].data, items + first, (size_t)(n - first) * sizeof(CbItem));
+        }
+    }
+
+    result = cb_commit_write_ex(cb_ptr, n);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    *inserted = n;
+    return CB_SUCCESS;
+}
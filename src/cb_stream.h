@@ -0,0 +1,62 @@
+/*
+    @file        cb_stream.h / cb_stream.c
+    @brief       Bulk insert with non-temporal (streaming) stores for recorder rings
+    @details
+     - `cb_stream_insert_bulk()` copies into the write segments and publishes
+       `in` once. In non-temporal mode the copy uses streaming stores, which
+       write around the cache: ring lines are not pulled into the producer's
+       cache and the producer's working set is not evicted by data that is
+       read much later by another thread.
+     - An `sfence` orders the streaming stores before `in` is published, so
+       the consumer never sees a slot before its contents.
+     - The mode is chosen per call: always cached, always non-temporal, or
+       automatic, where copies of at least `CB_STREAM_THRESHOLD` bytes stream
+       and smaller ones go through the cache. Small copies are likely still
+       cached when the consumer reads them.
+
+     Public API:
+       - `cb_stream_insert_bulk()` : Insert items with the chosen store mode
+       - `cb_stream_supported()`   : Whether streaming stores are available
+
+    @note Streaming stores need SSE2 (GCC/Clang on x86). Elsewhere every
+         mode copies through the cache.
+
+    @note As with spans, only free slots are written: overwrite mode does not
+         apply.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_STREAM_H
+#define CB_STREAM_H
+
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef CB_STREAM_THRESHOLD
+#define CB_STREAM_THRESHOLD (256u * 1024u)  // Bytes from which CB_STREAM_AUTO streams
+#endif
+
+/* Store modes */
+typedef enum {
+    CB_STREAM_AUTO = 0,             // Stream copies of at least CB_STREAM_THRESHOLD bytes
+    CB_STREAM_CACHED,               // Regular stores
+    CB_STREAM_NONTEMPORAL           // Streaming stores
+} cb_stream_mode_t;
+
+cb_result_t cb_stream_insert_bulk(cb *cb_ptr, const CbItem *items, CbIndex count,
+                                  cb_stream_mode_t mode, CbIndex *inserted);
+bool cb_stream_supported(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_STREAM_H */
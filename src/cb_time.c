@@ -0,0 +1,176 @@
+/*
+    @file        cb_time.h / cb_time.c
+    @brief       Time-windowed ring: items older than a horizon are evicted in bulk
+    @details
+     - See cb_time.h for the expiry rules.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include "cb_time.h"
+#include "cb_internal.h"
+
+static bool cb_time_expired(const cb_time_t *t, uint64_t stamp, uint64_t now) {
+    return now >= stamp && now - stamp >= t->horizon;
+}
+
+cb_result_t cb_time_init(cb_time_t *t, cb *ring, uint64_t *stamps, size_t stamp_count, uint64_t horizon) {
+    if (!t || !ring || !stamps) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (ring->size == 0 || stamp_count < (size_t)ring->size) {
+        return CB_ERROR_INVALID_SIZE;
+    }
+
+    t->ring = ring;
+    t->stamps = stamps;
+    t->horizon = horizon;
+    t->last = 0;
+
+    for (CbIndex i = 0; i < ring->size; i++) {
+        stamps[i] = 0;
+    }
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_time_expire(cb_time_t *t, uint64_t now, CbIndex *expired) {
+    if (!t) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    cb *ring = t->ring;
+    CbIndex size = ring->size;
+    CbIndex out = (CbIndex)CB_ATOMIC_LOAD(&ring->out);
+    CbIndex in = cb_internal_load_in(ring);
+
+    /* Stored timestamps are sorted: find the first live item */
+    CbIndex lo = 0;
+    CbIndex hi = cb_internal_used(in, out, size);
+    while (lo < hi) {
+        CbIndex mid = lo + (hi - lo) / 2;
+        if (cb_time_expired(t, t->stamps[cb_internal_advance(out, mid, size)], now)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if (lo > 0) {
+        cb_internal_publish_out(ring, cb_internal_advance(out, lo, size));
+    }
+
+    if (expired) {
+        *expired = lo;
+    }
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_time_insert(cb_time_t *t, CbItem item, uint64_t timestamp) {
+    if (!t) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (timestamp < t->last) {
+        CB_RETURN_ERROR(t->ring, CB_ERROR_INVALID_PARAMETER, "timestamp");
+    }
+
+    /* The slot at `in` is free; its timestamp is published together with the item */
+    t->stamps[(CbIndex)CB_ATOMIC_LOAD(&t->ring->in)] = timestamp;
+
+    cb_result_t result = cb_insert_ex(t->ring, item);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    t->last = timestamp;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_time_insert_bulk(cb_time_t *t, const CbItem *items, const uint64_t *timestamps,
+                                CbIndex count, CbIndex *inserted) {
+    if (!t || !items || !timestamps || !inserted) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *inserted = 0;
+    if (count == 0) {
+        CB_RETURN_ERROR(t->ring, CB_ERROR_INVALID_COUNT, "count");
+    }
+
+    uint64_t prev = t->last;
+    for (CbIndex i = 0; i < count; i++) {
+        if (timestamps[i] < prev) {
+            CB_RETURN_ERROR(t->ring, CB_ERROR_INVALID_PARAMETER, "timestamps");
+        }
+        prev = timestamps[i];
+    }
+
+    /* Stamp the slots the items will land in; without overwrite only the free ones */
+    cb *ring = t->ring;
+    CbIndex size = ring->size;
+    CbIndex in = (CbIndex)CB_ATOMIC_LOAD(&ring->in);
+    CbIndex stamped = count;
+    if (!cb_get_overwrite(ring)) {
+        CbIndex free_slots = size - 1 - cb_internal_used(in, cb_internal_load_out(ring), size);
+        stamped = (count < free_slots) ? count : free_slots;
+    }
+    for (CbIndex i = 0; i < stamped; i++) {
+        t->stamps[in] = timestamps[i];
+        in = cb_internal_advance(in, 1, size);
+    }
+
+    cb_result_t result = cb_insert_bulk_ex(ring, items, count, inserted);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    t->last = timestamps[*inserted - 1];
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_time_remove(cb_time_t *t, CbItem *item, uint64_t *timestamp) {
+    if (!t || !item) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    cb *ring = t->ring;
+    CbIndex out = (CbIndex)CB_ATOMIC_LOAD(&ring->out);
+    uint64_t stamp = 0;
+    if (cb_internal_load_in(ring) != out) {
+        stamp = t->stamps[out];
+    }
+
+    cb_result_t result = cb_remove_ex(ring, item);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    if (timestamp) {
+        *timestamp = stamp;
+    }
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_time_peek(const cb_time_t *t, CbIndex offset, CbItem *item, uint64_t *timestamp) {
+    if (!t || !item) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    const cb *ring = t->ring;
+    CbIndex out = (CbIndex)CB_ATOMIC_LOAD(&ring->out);
+
+    cb_result_t result = cb_peek_ex(ring, offset, item);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    if (timestamp) {
+        *timestamp = t->stamps[cb_internal_advance(out, offset, ring->size)];
+    }
+    return CB_SUCCESS;
+}
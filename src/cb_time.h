@@ -0,0 +1,79 @@
+/*
+    @file        cb_time.h / cb_time.c
+    @brief       Time-windowed ring: items older than a horizon are evicted in bulk
+    @details
+     - Every item carries a caller-supplied timestamp, kept in a parallel
+       array indexed by ring position. Timestamps must not decrease, so the
+       stored items are ordered by time.
+     - `cb_time_expire(now)` finds the first item younger than the horizon
+       by binary search over the stored timestamps and advances `out` past
+       all older items with a single store: O(log n), regardless of how many
+       items expire.
+     - Inserts never move `out`. Without overwrite, a ring full of expired
+       items rejects inserts with `CB_ERROR_BUFFER_FULL` until the consumer
+       expires them.
+     - The ring stays an ordinary `cb`: consumers may keep using
+       `cb_remove()`, `cb_peek()` and the span API; items they see were live
+       at the last expiry.
+
+     Public API:
+       - `cb_time_init()`        : Attach a timestamp array and horizon to a ring
+       - `cb_time_insert()`      : Insert an item with its timestamp
+       - `cb_time_insert_bulk()` : Insert items with their timestamps
+       - `cb_time_expire()`      : Drop every item older than the horizon
+       - `cb_time_remove()`      : Remove the oldest item and its timestamp
+       - `cb_time_peek()`        : Read an item and its timestamp without removing it
+
+    @note An item is expired once `now - timestamp >= horizon`. Timestamps use
+         any monotonic unit; the library never reads a clock.
+
+    @note Expiry moves `out`, like overwrite mode. Call it from the consumer
+         thread, or from the producer only when no consumer runs concurrently.
+
+    @note Items stored before `cb_time_init()` are given timestamp 0.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_TIME_H
+#define CB_TIME_H
+
+#include <stddef.h>
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Time-windowed ring */
+typedef struct {
+    cb *ring;                       // Underlying buffer
+    uint64_t *stamps;               // Timestamp per ring slot
+    uint64_t horizon;               // Items this old or older expire
+    uint64_t last;                  // Newest timestamp inserted
+} cb_time_t;
+
+/* Initialization */
+cb_result_t cb_time_init(cb_time_t *t, cb *ring, uint64_t *stamps, size_t stamp_count, uint64_t horizon);
+
+/* Producer */
+cb_result_t cb_time_insert(cb_time_t *t, CbItem item, uint64_t timestamp);
+cb_result_t cb_time_insert_bulk(cb_time_t *t, const CbItem *items, const uint64_t *timestamps,
+                                CbIndex count, CbIndex *inserted);
+
+/* Expiry */
+cb_result_t cb_time_expire(cb_time_t *t, uint64_t now, CbIndex *expired);
+
+/* Consumer */
+cb_result_t cb_time_remove(cb_time_t *t, CbItem *item, uint64_t *timestamp);
+cb_result_t cb_time_peek(const cb_time_t *t, CbIndex offset, CbItem *item, uint64_t *timestamp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_TIME_H */
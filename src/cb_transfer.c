@@ -0,0 +1,138 @@
+/*
+    @file        cb_transfer.h / cb_transfer.c
+    @brief       Ring-to-ring transfer with an optional transform, without a bounce buffer
+    @details
+     - See cb_transfer.h for the chunking and publication rules.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#include <limits.h>  // For CHAR_BIT
+#include <string.h>
+#include "cb_transfer.h"
+#include "cb_internal.h"
+
+/* Pointer to the item `pos` items into a pair of segments */
+static CbItem *cb_transfer_at(const cb_span_t spans[2], CbIndex pos, CbIndex *contiguous) {
+    if (pos < spans[0].count) {
+        *contiguous = spans[0].count - pos;
+        return spans[0].data + pos;
+    }
+    *contiguous = spans[1].count - (pos - spans[0].count);
+    return spans[1].data + (pos - spans[0].count);
+}
+
+cb_result_t cb_transfer(cb *dst, cb *src, CbIndex max, cb_transfer_fn_t fn, void *ctx, CbIndex *moved) {
+    if (!dst || !src || !moved) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    *moved = 0;
+    if (dst == src) {
+        CB_RETURN_ERROR(dst, CB_ERROR_INVALID_PARAMETER, "dst");
+    }
+
+    if (max == 0) {
+        CB_RETURN_ERROR(src, CB_ERROR_INVALID_COUNT, "max");
+    }
+
+    cb_span_t in_spans[2];
+    cb_span_t out_spans[2];
+    CbIndex readable, writable;
+
+    cb_result_t result = cb_get_read_spans_ex(src, in_spans, &readable);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    result = cb_get_write_spans_ex(dst, out_spans, &writable);
+    if (result != CB_SUCCESS) {
+        return result;
+    }
+
+    if (readable > max) {
+        readable = max;
+    }
+
+    CbIndex consumed = 0;
+    CbIndex produced = 0;
+    while (consumed < readable && produced < writable) {
+        CbIndex in_run, out_run;
+        const CbItem *from = cb_transfer_at(in_spans, consumed, &in_run);
+        CbItem *to = cb_transfer_at(out_spans, produced, &out_run);
+
+        CbIndex n = readable - consumed;
+        if (n > in_run) {
+            n = in_run;
+        }
+        if (n > out_run) {
+            n = out_run;
+        }
+
+        if (fn) {
+            CbIndex written = fn(from, to, n, ctx);
+            produced += (written < n) ? written : n;
+        } else {
+            memcpy(to, from, (size_t)n * sizeof(CbItem));
+            produced += n;
+        }
+        consumed += n;
+    }
+
+    /* Publish downstream first, then free the source slots */
+    cb_commit_write_ex(dst, produced);
+    cb_commit_read_ex(src, consumed);
+
+    *moved = consumed;
+    return CB_SUCCESS;
+}
+
+CbIndex cb_transfer_bswap(const CbItem *src, CbItem *dst, CbIndex count, void *ctx) {
+    (void)ctx;
+
+    const uint8_t *s = (const uint8_t *)src;
+    uint8_t *d = (uint8_t *)dst;
+    const size_t width = sizeof(CbItem);
+
+    for (size_t i = 0; i < (size_t)count; i++) {
+        for (size_t b = 0; b < width; b++) {
+            d[i * width + b] = s[i * width + (width - 1 - b)];
+        }
+    }
+    return count;
+}
+
+/* Convert a scaled value to CbItem, saturating at the limits of integer item
+   types; NaN becomes the lower limit. Floating-point items are converted as is. */
+static inline CbItem cb_transfer_clamp(float v) {
+    const bool is_float = (CbItem)0.5f != (CbItem)0;
+    const bool is_signed = (CbItem)-1 < (CbItem)1;
+
+    if (is_float) {
+        return (CbItem)v;
+    }
+
+    const CbItem hi = is_signed ? (CbItem)(((uintmax_t)1 << (sizeof(CbItem) * CHAR_BIT - 1)) - 1) : (CbItem)-1;
+    const CbItem lo = is_signed ? (CbItem)(-hi - 1) : (CbItem)0;
+    if (!(v >= (float)lo)) {
+        return lo;
+    }
+    /* (float)hi may round up past hi, so compare with >= */
+    if (v >= (float)hi) {
+        return hi;
+    }
+    return (CbItem)v;
+}
+
+CbIndex cb_transfer_scale(const CbItem *src, CbItem *dst, CbIndex count, void *ctx) {
+    const float factor = ctx ? *(const float *)ctx : 1.0f;
+
+    for (CbIndex i = 0; i < count; i++) {
+        dst[i] = CB_TRANSFER_SCALE(src[i], factor);
+    }
+    return count;
+}
@@ -0,0 +1,66 @@
+/*
+    @file        cb_transfer.h / cb_transfer.c
+    @brief       Ring-to-ring transfer with an optional transform, without a bounce buffer
+    @details
+     - `cb_transfer()` moves items from the source ring's read segments
+       straight into the destination ring's write segments, instead of
+       `cb_remove_bulk()` into a temporary array followed by
+       `cb_insert_bulk()`, which copies everything twice.
+     - The work is split into contiguous chunks that lie within one segment
+       of each ring. Each chunk is passed to a transform callback, or copied
+       with `memcpy` when there is none.
+     - A callback may write fewer items than it reads, so it can filter as well.
+     - Both indices are published once per call: the destination `in` first,
+       then the source `out`.
+     - Built-in transforms are plain loops over contiguous arrays that the
+       compiler vectorizes: byte swap of every item, and scaling by a factor.
+
+     Public API:
+       - `cb_transfer()`       : Move up to `max` items, applying a transform
+       - `cb_transfer_bswap()` : Built-in: reverse the bytes of each item
+       - `cb_transfer_scale()` : Built-in: multiply each item by `*(const float *)ctx`,
+                                 saturating to the item range
+
+    @note The caller acts as the source's only consumer and the destination's
+         only producer. The rings must be distinct.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef CB_TRANSFER_H
+#define CB_TRANSFER_H
+
+#include "cb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Scaling used by cb_transfer_scale(); the default saturates the product to the
+   CbItem range, since converting an out-of-range float to an integer is undefined */
+#ifndef CB_TRANSFER_SCALE
+#define CB_TRANSFER_SCALE(item, factor) cb_transfer_clamp((float)(item) * (factor))
+#endif
+
+/*
+ * Transform callback: read `count` items from `src`, write at most `count`
+ * items to `dst` and return how many were written. The arrays never overlap.
+ */
+typedef CbIndex (*cb_transfer_fn_t)(const CbItem *src, CbItem *dst, CbIndex count, void *ctx);
+
+/* Transfer */
+cb_result_t cb_transfer(cb *dst, cb *src, CbIndex max, cb_transfer_fn_t fn, void *ctx, CbIndex *moved);
+
+/* Built-in transforms */
+CbIndex cb_transfer_bswap(const CbItem *src, CbItem *dst, CbIndex count, void *ctx);
+CbIndex cb_transfer_scale(const CbItem *src, CbItem *dst, CbIndex count, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CB_TRANSFER_H */
@@ -0,0 +1,162 @@
+/*
+    @file        cb_wait.h / cb_wait.c
+    @brief       Blocking consumer waits with symmetric or asymmetric fences (Linux)
+    @details
+     - See cb_wait.h for the wake protocol and the two fence modes.
+
+    @date 2026-10-18
+    @version 1.2
+    @author Eray Ozturk | erayozturk1@gmail.com
+    @url github.com/diffstorm
+    @license MIT License
+*/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // For syscall
+#endif
+
+#include "cb_wait.h"
+#include "cb_internal.h"
+#include <time.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+
+/* Process-wide membarrier registration: 0 = not tried, 1 = registered, -1 = unavailable */
+static int cb_wait_membarrier_state;
+
+static bool cb_wait_membarrier_register(void) {
+    int state = __atomic_load_n(&cb_wait_membarrier_state, __ATOMIC_ACQUIRE);
+    if (state == 0) {
+        long supported = syscall(__NR_membarrier, MEMBARRIER_CMD_QUERY, 0, 0);
+        state = -1;
+        if (supported > 0 && (supported & MEMBARRIER_CMD_PRIVATE_EXPEDITED) &&
+            syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) == 0) {
+            state = 1;
+        }
+        __atomic_store_n(&cb_wait_membarrier_state, state, __ATOMIC_RELEASE);
+    }
+    return state > 0;
+}
+
+/* Full fence matching the consumer's; only the symmetric mode pays for it here */
+static inline void cb_wait_producer_fence(const cb_wait_t *w) {
+    if (w->mode == CB_WAIT_SYMMETRIC) {
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    } else {
+        __atomic_signal_fence(__ATOMIC_SEQ_CST);
+    }
+}
+
+static inline void cb_wait_consumer_fence(const cb_wait_t *w) {
+    if (w->mode == CB_WAIT_SYMMETRIC) {
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    } else {
+        syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0, 0);
+    }
+}
+
+/* Wake the consumer if it announced a sleep; called after `in` was published */
+static void cb_wait_notify(cb_wait_t *w) {
+    cb_wait_producer_fence(w);
+    if (__atomic_load_n(&w->waiting, __ATOMIC_RELAXED) &&
+        __atomic_exchange_n(&w->waiting, 0, __ATOMIC_ACQ_REL)) {
+        __atomic_fetch_add(&w->seq, 1, __ATOMIC_RELEASE);
+        syscall(SYS_futex, &w->seq, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+        w->wakes++;
+    }
+}
+
+static uint64_t cb_wait_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000u + (uint64_t)ts.tv_nsec / 1000000u;
+}
+
+cb_result_t cb_wait_init(cb_wait_t *w, cb *ring, cb_wait_mode_t mode) {
+    if (!w || !ring) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    if (mode != CB_WAIT_SYMMETRIC && mode != CB_WAIT_ASYMMETRIC) {
+        CB_RETURN_ERROR(ring, CB_ERROR_INVALID_PARAMETER, "mode");
+    }
+
+    w->ring = ring;
+    w->mode = (mode == CB_WAIT_ASYMMETRIC && cb_wait_membarrier_register()) ? CB_WAIT_ASYMMETRIC
+                                                                            : CB_WAIT_SYMMETRIC;
+    w->seq = 0;
+    w->waiting = 0;
+    w->sleeps = 0;
+    w->wakes = 0;
+    return CB_SUCCESS;
+}
+
+cb_result_t cb_wait_insert(cb_wait_t *w, CbItem item) {
+    if (!w) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    cb_result_t result = cb_insert_ex(w->ring, item);
+    if (result == CB_SUCCESS) {
+        cb_wait_notify(w);
+    }
+    return result;
+}
+
+cb_result_t cb_wait_insert_bulk(cb_wait_t *w, const CbItem *items, CbIndex count, CbIndex *inserted) {
+    if (!w) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    cb_result_t result = cb_insert_bulk_ex(w->ring, items, count, inserted);
+    if (result == CB_SUCCESS) {
+        cb_wait_notify(w);
+    }
+    return result;
+}
+
+cb_result_t cb_wait_remove(cb_wait_t *w, CbItem *item, uint32_t timeout_ms) {
+    if (!w || !item) {
+        return CB_ERROR_NULL_POINTER;
+    }
+
+    const bool forever = timeout_ms == CB_WAIT_FOREVER;
+    const uint64_t deadline = forever ? 0 : cb_wait_now_ms() + timeout_ms;
+    unsigned spins = 0;
+
+    for (;;) {
+        cb_result_t result = cb_remove_ex(w->ring, item);
+        if (result != CB_ERROR_BUFFER_EMPTY || timeout_ms == CB_NO_WAIT) {
+            return result;
+        }
+
+        if (spins < CB_WAIT_SPIN) {
+            spins++;
+            continue;
+        }
+
+        struct timespec remaining;
+        struct timespec *timeout = NULL;
+        if (!forever) {
+            uint64_t now = cb_wait_now_ms();
+            if (now >= deadline) {
+                CB_RETURN_ERROR(w->ring, CB_ERROR_TIMEOUT, "timeout_ms");
+            }
+            remaining.tv_sec = (time_t)((deadline - now) / 1000u);
+            remaining.tv_nsec = (long)((deadline - now) % 1000u) * 1000000L;
+            timeout = &remaining;
+        }
+
+        /* Announce the sleep, fence, and look once more before sleeping */
+        uint32_t seq = __atomic_load_n(&w->seq, __ATOMIC_ACQUIRE);
+        __atomic_store_n(&w->waiting, 1, __ATOMIC_RELAXED);
+        cb_wait_consumer_fence(w);
+        if (cb_dataSize(w->ring) == 0) {
+            syscall(SYS_futex, &w->seq, FUTEX_WAIT_PRIVATE, seq, timeout, NULL, 0);
+            w->sleeps++;
+        }
+        __atomic_store_n(&w->waiting, 0, __ATOMIC_RELAXED);
+    }
+}
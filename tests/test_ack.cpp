@@ -0,0 +1,134 @@
+#include "test_common.h"
+#include "cb_ack.h"
+#include <thread>
+#include <atomic>
+
+#define ACK_RING 64
+
+// Define AckTest fixture
+class AckTest : public ::testing::Test {
+protected:
+    cb ring;
+    cb_ack_t a;
+    CbItem storage[ACK_RING];
+
+    void SetUp() override {
+        ASSERT_EQ(cb_init_ex(&ring, storage, ACK_RING), CB_SUCCESS);
+        ASSERT_EQ(cb_ack_init(&a, &ring, 8), CB_SUCCESS);
+    }
+
+    void TearDown() override {
+        // Reset buffer statistics
+        cb_reset_stats(&ring);
+    }
+
+    void fill(CbItem first, CbIndex count) {
+        for (CbIndex i = 0; i < count; i++) {
+            ASSERT_TRUE(cb_insert(&ring, (CbItem)(first + i)));
+        }
+    }
+};
+
+// Slots are released per batch; occupancy counts them until then
+TEST_F(AckTest, ReleasePerBatch) {
+    fill(0, 20);
+
+    CbItem item;
+    for (int i = 0; i < 7; i++) {
+        ASSERT_EQ(cb_ack_remove(&a, &item), CB_SUCCESS);
+        EXPECT_EQ(item, (CbItem)i);
+    }
+    EXPECT_EQ(cb_dataSize(&ring), 20u);
+    EXPECT_EQ(cb_ack_count(&a), 13u);
+
+    ASSERT_EQ(cb_ack_remove(&a, &item), CB_SUCCESS);
+    EXPECT_EQ(cb_dataSize(&ring), 12u);
+    EXPECT_EQ(a.releases, 1u);
+
+    ASSERT_EQ(cb_ack_remove(&a, &item), CB_SUCCESS);
+    ASSERT_EQ(cb_ack_release(&a), CB_SUCCESS);
+    EXPECT_EQ(cb_dataSize(&ring), 11u);
+    EXPECT_EQ(cb_ack_count(&a), 11u);
+}
+
+// Draining everything visible releases at once
+TEST_F(AckTest, ReleaseWhenEmpty) {
+    fill(0, 5);
+
+    CbItem item;
+    for (int i = 0; i < 5; i++) {
+        ASSERT_EQ(cb_ack_remove(&a, &item), CB_SUCCESS);
+    }
+    EXPECT_EQ(cb_dataSize(&ring), 0u);
+    EXPECT_EQ(cb_ack_remove(&a, &item), CB_ERROR_BUFFER_EMPTY);
+
+    // The producer sees a ring with room for a full capacity again
+    fill(5, ACK_RING - 1);
+    EXPECT_FALSE(cb_insert(&ring, 0));
+
+    CbItem items[100];
+    CbIndex removed;
+    ASSERT_EQ(cb_ack_remove_bulk(&a, items, 40, &removed), CB_SUCCESS);
+    EXPECT_EQ(removed, 40u);
+    EXPECT_EQ(items[0], 5);
+    EXPECT_EQ(cb_dataSize(&ring), (CbIndex)(ACK_RING - 1 - 40));
+
+    ASSERT_EQ(cb_ack_remove_bulk(&a, items, 100, &removed), CB_SUCCESS);
+    EXPECT_EQ(removed, (CbIndex)(ACK_RING - 1 - 40));
+    EXPECT_EQ(items[0], (CbItem)(5 + 40));
+    EXPECT_EQ(cb_dataSize(&ring), 0u);
+    EXPECT_EQ(cb_ack_remove_bulk(&a, items, 100, &removed), CB_ERROR_BUFFER_EMPTY);
+}
+
+// A concurrent producer never overwrites unreleased slots
+TEST_F(AckTest, ConcurrentProducer) {
+    const int total = 20000;
+    std::atomic<bool> stop{false};
+
+    std::thread producer([&]() {
+        int i = 0;
+        while (i < total && !stop.load()) {
+            if (cb_insert(&ring, (CbItem)i)) {
+                i++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int received = 0;
+    bool ordered = true;
+    CbItem item;
+    while (received < total) {
+        if (cb_ack_remove(&a, &item) == CB_SUCCESS) {
+            ordered = ordered && item == (CbItem)received;
+            received++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    stop.store(true);
+    producer.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_LT(a.releases, (uint64_t)total);
+}
+
+// Invalid arguments are rejected
+TEST_F(AckTest, Errors) {
+    cb_ack_t other;
+    CbItem item;
+    CbIndex removed;
+
+    EXPECT_EQ(cb_ack_init(&other, &ring, 0), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_ack_init(NULL, &ring, 4), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_ack_remove(&a, NULL), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_ack_remove_bulk(&a, &item, 0, &removed), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_ack_remove(&a, &item), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_ack_count(NULL), 0u);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,174 @@
+#include "test_common.h"
+#include "cb_actor.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#define ACTOR_MAILBOX 64
+
+// Define ActorTest fixture
+class ActorTest : public ::testing::Test {
+protected:
+    cb_actor_runtime_t rt;
+    cb_actor_run_slot_t run_slots[8];
+    cb_actor_t actors[4];
+    cb_actor_slot_t mailboxes[4][ACTOR_MAILBOX];
+
+    struct Log {
+        std::vector<uint64_t> values;
+        std::atomic<uint64_t> sum{0};
+        std::atomic<uint64_t> count{0};
+    };
+    Log logs[4];
+
+    void SetUp() override {
+        ASSERT_EQ(cb_actor_runtime_init(&rt, run_slots, 8, 4), CB_SUCCESS);
+        for (int i = 0; i < 4; i++) {
+            ASSERT_EQ(cb_actor_init(&rt, &actors[i], mailboxes[i], ACTOR_MAILBOX, record, &logs[i]), CB_SUCCESS);
+        }
+    }
+
+    void TearDown() override {
+        // Stop any running workers
+        cb_actor_stop(&rt);
+    }
+
+    static void record(cb_actor_t *self, const cb_actor_msg_t *msg, void *ctx) {
+        (void)self;
+        Log *log = (Log *)ctx;
+        if (msg->type == 0) {
+            log->values.push_back(msg->value);
+        }
+        log->sum += msg->value;
+        log->count++;
+    }
+
+    unsigned drain() {
+        unsigned total = 0, handled;
+        while (cb_actor_run_once(&rt, &handled) == CB_SUCCESS) {
+            total += handled;
+        }
+        return total;
+    }
+};
+
+// Idle actors are not scheduled; a send schedules an actor once
+TEST_F(ActorTest, SchedulesOnSend) {
+    unsigned handled;
+    EXPECT_EQ(cb_actor_run_once(&rt, &handled), CB_ERROR_BUFFER_EMPTY);
+
+    ASSERT_EQ(cb_actor_send(&actors[1], NULL, 0, 10), CB_SUCCESS);
+    ASSERT_EQ(cb_actor_send(&actors[1], NULL, 0, 11), CB_SUCCESS);
+    ASSERT_EQ(cb_actor_run_once(&rt, &handled), CB_SUCCESS);
+    EXPECT_EQ(handled, 2u);
+    EXPECT_EQ(cb_actor_run_once(&rt, &handled), CB_ERROR_BUFFER_EMPTY);
+
+    EXPECT_EQ(logs[1].values, (std::vector<uint64_t>{ 10, 11 }));
+    EXPECT_EQ(actors[1].turns, 1u);
+    EXPECT_EQ(actors[0].turns, 0u);
+}
+
+// A turn handles at most `batch` messages and requeues behind other actors
+TEST_F(ActorTest, BoundedBatchRoundRobin) {
+    for (uint64_t i = 0; i < 10; i++) {
+        ASSERT_EQ(cb_actor_send(&actors[0], NULL, 0, i), CB_SUCCESS);
+    }
+    ASSERT_EQ(cb_actor_send(&actors[2], NULL, 0, 100), CB_SUCCESS);
+
+    unsigned handled;
+    ASSERT_EQ(cb_actor_run_once(&rt, &handled), CB_SUCCESS);
+    EXPECT_EQ(handled, 4u);
+    ASSERT_EQ(cb_actor_run_once(&rt, &handled), CB_SUCCESS);
+    EXPECT_EQ(handled, 1u);
+    EXPECT_EQ(logs[2].values.size(), 1u);
+
+    EXPECT_EQ(drain(), 6u);
+    EXPECT_EQ(actors[0].turns, 3u);
+    ASSERT_EQ(logs[0].values.size(), 10u);
+    for (uint64_t i = 0; i < 10; i++) {
+        EXPECT_EQ(logs[0].values[i], i);
+    }
+}
+
+// A full mailbox rejects the message; slots are reused after handling
+TEST_F(ActorTest, MailboxFull) {
+    for (uint64_t i = 0; i < ACTOR_MAILBOX; i++) {
+        ASSERT_EQ(cb_actor_send(&actors[3], NULL, 0, i), CB_SUCCESS);
+    }
+    EXPECT_EQ(cb_actor_send(&actors[3], NULL, 0, 99), CB_ERROR_BUFFER_FULL);
+
+    EXPECT_EQ(drain(), (unsigned)ACTOR_MAILBOX);
+    ASSERT_EQ(cb_actor_send(&actors[3], NULL, 0, 99), CB_SUCCESS);
+    EXPECT_EQ(drain(), 1u);
+    EXPECT_EQ(logs[3].values.back(), 99u);
+}
+
+// Several sender threads and workers deliver every message exactly once
+TEST_F(ActorTest, ConcurrentSenders) {
+    const int senders = 4;
+    const uint64_t per_sender = 20000;
+    ASSERT_EQ(cb_actor_start(&rt, 2), CB_SUCCESS);
+
+    std::vector<std::thread> threads;
+    for (int s = 0; s < senders; s++) {
+        threads.emplace_back([&, s]() {
+            for (uint64_t i = 1; i <= per_sender; i++) {
+                cb_actor_t *target = &actors[(i + s) % 4];
+                while (cb_actor_send(target, NULL, 1, i) != CB_SUCCESS) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    uint64_t expected = senders * per_sender;
+    for (int spin = 0; spin < 20000; spin++) {
+        uint64_t count = 0;
+        for (auto &log : logs) {
+            count += log.count;
+        }
+        if (count == expected) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(cb_actor_stop(&rt), CB_SUCCESS);
+
+    uint64_t count = 0, sum = 0;
+    for (auto &log : logs) {
+        count += log.count;
+        sum += log.sum;
+    }
+    EXPECT_EQ(count, expected);
+    EXPECT_EQ(sum, senders * per_sender * (per_sender + 1) / 2);
+}
+
+// Invalid arguments and limits
+TEST_F(ActorTest, Errors) {
+    cb_actor_runtime_t other;
+    cb_actor_run_slot_t two[2];
+    cb_actor_t extra;
+    cb_actor_slot_t slots[ACTOR_MAILBOX];
+
+    EXPECT_EQ(cb_actor_runtime_init(&other, two, 3, 1), CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_actor_runtime_init(&other, two, 2, 0), CB_ERROR_INVALID_COUNT);
+    ASSERT_EQ(cb_actor_runtime_init(&other, two, 2, 1), CB_SUCCESS);
+    ASSERT_EQ(cb_actor_init(&other, &extra, slots, ACTOR_MAILBOX, record, &logs[0]), CB_SUCCESS);
+    ASSERT_EQ(cb_actor_init(&other, &extra, slots, ACTOR_MAILBOX, record, &logs[0]), CB_SUCCESS);
+    EXPECT_EQ(cb_actor_init(&other, &extra, slots, ACTOR_MAILBOX, record, &logs[0]), CB_ERROR_BUFFER_FULL);
+
+    EXPECT_EQ(cb_actor_init(&rt, &extra, slots, 48, record, NULL), CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_actor_init(&rt, &extra, slots, ACTOR_MAILBOX, NULL, NULL), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_actor_send(NULL, NULL, 0, 0), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_actor_run_once(&rt, NULL), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_actor_start(&rt, 0), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_actor_start(&rt, CB_ACTOR_MAX_WORKERS + 1), CB_ERROR_INVALID_COUNT);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
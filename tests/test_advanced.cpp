@@ -151,6 +151,60 @@ TEST_F(CircularBufferTest, MultiThreaded) {
     EXPECT_EQ(cb_dataSize(&buffer), 0);
 }
 
+// Test zero-copy spans across the wrap point
+TEST_F(CircularBufferTest, SpansWrapAround) {
+    // Move in/out close to the end of storage
+    fillBuffer(TEST_BUFFER_SIZE_MEDIUM - 4);
+    CbItem drain[TEST_BUFFER_SIZE_MEDIUM];
+    EXPECT_EQ(cb_remove_bulk(&buffer, drain, TEST_BUFFER_SIZE_MEDIUM - 4), TEST_BUFFER_SIZE_MEDIUM - 4);
+    
+    // Write 8 items through write spans; they must wrap
+    cb_span_t spans[2];
+    CbIndex free_slots = cb_get_write_spans(&buffer, spans);
+    EXPECT_EQ(free_slots, TEST_BUFFER_SIZE_MEDIUM - 1);
+    EXPECT_EQ(spans[0].count, 4);
+    EXPECT_EQ(spans[1].count, TEST_BUFFER_SIZE_MEDIUM - 5);
+    for (CbIndex i = 0; i < 4; i++) {
+        spans[0].data[i] = (CbItem)(50 + i);
+    }
+    for (CbIndex i = 0; i < 4; i++) {
+        spans[1].data[i] = (CbItem)(54 + i);
+    }
+    
+    // Nothing is visible before commit
+    EXPECT_EQ(cb_dataSize(&buffer), 0);
+    EXPECT_TRUE(cb_commit_write(&buffer, 8));
+    EXPECT_EQ(cb_dataSize(&buffer), 8);
+    
+    // Read spans expose the same two segments
+    EXPECT_EQ(cb_get_read_spans(&buffer, spans), 8);
+    EXPECT_EQ(spans[0].count, 4);
+    EXPECT_EQ(spans[1].count, 4);
+    EXPECT_EQ(spans[0].data[0], 50);
+    EXPECT_EQ(spans[1].data[3], 57);
+    
+    // Partial release keeps the rest in order
+    EXPECT_TRUE(cb_commit_read(&buffer, 5));
+    verifyBufferContents(55, 3);
+    verifyBufferEmpty();
+}
+
+// Test zero-copy span error handling
+TEST_F(CircularBufferTest, SpansErrors) {
+    cb_span_t spans[2];
+    CbIndex available = 0;
+    
+    EXPECT_EQ(cb_get_read_spans_ex(&buffer, spans, &available), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(available, 0);
+    EXPECT_EQ(cb_commit_read_ex(&buffer, 1), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_commit_write_ex(&buffer, TEST_BUFFER_SIZE_MEDIUM), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_get_read_spans_ex(nullptr, spans, &available), CB_ERROR_NULL_POINTER);
+    
+    fillBuffer(TEST_BUFFER_SIZE_MEDIUM - 1);
+    EXPECT_EQ(cb_get_write_spans_ex(&buffer, spans, &available), CB_ERROR_BUFFER_FULL);
+    EXPECT_EQ(available, 0);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -1,4 +1,5 @@
 #include "test_common.h"
+#include <cstring>
 
 // Test basic initialization
 TEST_F(CircularBufferTest, Initialization) {
@@ -146,6 +147,23 @@ TEST_F(CircularBufferTest, SanityCheck) {
     EXPECT_FALSE(cb_sanity_check(&buffer));
 }
 
+// C++ callers see the index fields where the C library stores them
+TEST_F(CircularBufferTest, FieldLayoutMatchesLibrary) {
+    cb ring;
+    CbItem storage[8];
+    memset(&ring, 0xA5, sizeof(ring));
+    ASSERT_EQ(cb_init_ex(&ring, storage, 8), CB_SUCCESS);
+    EXPECT_EQ(ring.in, 0u);
+    EXPECT_EQ(ring.out, 0u);
+    EXPECT_FALSE(ring.overwrite);
+
+    ASSERT_TRUE(cb_insert(&ring, 1));
+    ASSERT_TRUE(cb_insert(&ring, 2));
+    cb_set_overwrite(&ring, true);
+    EXPECT_EQ(ring.in, 2u);
+    EXPECT_TRUE(ring.overwrite);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
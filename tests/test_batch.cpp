@@ -0,0 +1,175 @@
+#include "test_common.h"
+#include "cb_batch.h"
+#include <thread>
+#include <atomic>
+
+#define BATCH_RING 128
+
+// Define BatchTest fixture
+class BatchTest : public ::testing::Test {
+protected:
+    cb ring;
+    cb_batch_t b;
+    CbItem storage[BATCH_RING];
+
+    void SetUp() override {
+        ASSERT_EQ(cb_init_ex(&ring, storage, BATCH_RING), CB_SUCCESS);
+        ASSERT_EQ(cb_batch_init(&b, &ring, 4, 32, 10, 80), CB_SUCCESS);
+    }
+
+    void TearDown() override {
+        // Reset buffer statistics
+        cb_reset_stats(&ring);
+    }
+};
+
+// Items become visible only when the count limit is reached or on flush
+TEST_F(BatchTest, PublishOnCountAndFlush) {
+    for (int i = 0; i < 3; i++) {
+        ASSERT_EQ(cb_batch_insert(&b, (CbItem)i, 0), CB_SUCCESS);
+        EXPECT_EQ(cb_dataSize(&ring), 0u);
+    }
+    ASSERT_EQ(cb_batch_insert(&b, 3, 0), CB_SUCCESS);
+    EXPECT_EQ(cb_dataSize(&ring), 4u);
+    EXPECT_EQ(b.last_reason, CB_BATCH_BY_COUNT);
+    EXPECT_EQ(b.batch, 8u);
+    EXPECT_EQ(b.budget, 20u);
+
+    ASSERT_EQ(cb_batch_insert(&b, 4, 1), CB_SUCCESS);
+    EXPECT_EQ(cb_dataSize(&ring), 4u);
+    ASSERT_EQ(cb_batch_flush(&b), CB_SUCCESS);
+    EXPECT_EQ(cb_dataSize(&ring), 5u);
+    EXPECT_EQ(b.batch, 8u);
+
+    CbItem item;
+    for (int i = 0; i < 5; i++) {
+        ASSERT_TRUE(cb_remove(&ring, &item));
+        EXPECT_EQ(item, (CbItem)i);
+    }
+}
+
+// The time budget bounds latency and shrinks the limits under light load
+TEST_F(BatchTest, PublishOnTime) {
+    // Grow first with a burst
+    for (int i = 0; i < 4 + 8 + 16; i++) {
+        ASSERT_EQ(cb_batch_insert(&b, (CbItem)i, 0), CB_SUCCESS);
+    }
+    EXPECT_EQ(b.batch, 32u);
+    EXPECT_EQ(b.budget, 80u);
+    CbIndex published = cb_dataSize(&ring);
+
+    ASSERT_EQ(cb_batch_insert(&b, 1, 100), CB_SUCCESS);
+    ASSERT_EQ(cb_batch_tick(&b, 179), CB_SUCCESS);
+    EXPECT_EQ(cb_dataSize(&ring), published);
+    ASSERT_EQ(cb_batch_tick(&b, 180), CB_SUCCESS);
+    EXPECT_EQ(cb_dataSize(&ring), published + 1);
+    EXPECT_EQ(b.last_reason, CB_BATCH_BY_TIME);
+    EXPECT_EQ(b.batch, 16u);
+    EXPECT_EQ(b.budget, 40u);
+
+    // An insert past the budget publishes by itself
+    ASSERT_EQ(cb_batch_insert(&b, 2, 200), CB_SUCCESS);
+    ASSERT_EQ(cb_batch_insert(&b, 3, 240), CB_SUCCESS);
+    EXPECT_EQ(cb_dataSize(&ring), published + 3);
+    EXPECT_EQ(b.budget, 20u);
+
+    for (int i = 0; i < 10; i++) {
+        ASSERT_EQ(cb_batch_insert(&b, 4, 1000 + i * 100), CB_SUCCESS);
+    }
+    EXPECT_EQ(b.batch, 4u);
+    EXPECT_EQ(b.budget, 10u);
+}
+
+// A full ring publishes what is pending and reports full
+TEST_F(BatchTest, FullAndBulk) {
+    CbItem items[200];
+    for (int i = 0; i < 200; i++) {
+        items[i] = (CbItem)i;
+    }
+
+    CbIndex inserted;
+    ASSERT_EQ(cb_batch_insert_bulk(&b, items, 3, 0, &inserted), CB_SUCCESS);
+    EXPECT_EQ(inserted, 3u);
+    EXPECT_EQ(cb_dataSize(&ring), 0u);
+
+    ASSERT_EQ(cb_batch_insert_bulk(&b, items + 3, 197, 0, &inserted), CB_SUCCESS);
+    EXPECT_EQ(inserted, (CbIndex)(BATCH_RING - 1 - 3));
+    EXPECT_EQ(cb_dataSize(&ring), (CbIndex)(BATCH_RING - 1));
+
+    EXPECT_EQ(cb_batch_insert(&b, 0, 0), CB_ERROR_BUFFER_FULL);
+    EXPECT_EQ(cb_batch_insert_bulk(&b, items, 1, 0, &inserted), CB_ERROR_BUFFER_FULL);
+
+    CbItem item;
+    for (int i = 0; i < 100; i++) {
+        ASSERT_TRUE(cb_remove(&ring, &item));
+        ASSERT_EQ(item, (CbItem)i);
+    }
+    ASSERT_EQ(cb_batch_insert_bulk(&b, items, 90, 0, &inserted), CB_SUCCESS);
+    EXPECT_EQ(inserted, 90u);
+    ASSERT_EQ(cb_batch_flush(&b), CB_SUCCESS);
+    EXPECT_EQ(cb_dataSize(&ring), (CbIndex)(BATCH_RING - 1 - 10));
+}
+
+// A concurrent consumer sees every item in order
+TEST_F(BatchTest, ConcurrentConsumer) {
+    const int total = 200000;
+    std::atomic<bool> done{false};
+    std::atomic<int> received{0};
+    std::atomic<bool> ordered{true};
+
+    std::thread consumer([&]() {
+        CbItem item;
+        while (received.load() < total) {
+            if (cb_remove(&ring, &item)) {
+                if (item != (CbItem)received.load()) {
+                    ordered.store(false);
+                }
+                received++;
+            } else if (done.load()) {
+                break;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint64_t now = 0;
+    for (int i = 0; i < total; now++) {
+        if (cb_batch_insert(&b, (CbItem)i, now) == CB_SUCCESS) {
+            i++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    cb_batch_flush(&b);
+    while (received.load() < total && cb_dataSize(&ring) > 0) {
+        std::this_thread::yield();
+    }
+    done.store(true);
+    consumer.join();
+
+    EXPECT_EQ(received.load(), total);
+    EXPECT_TRUE(ordered.load());
+}
+
+// Invalid arguments are rejected
+TEST_F(BatchTest, Errors) {
+    cb_batch_t other;
+    CbIndex inserted;
+    CbItem item = 0;
+
+    EXPECT_EQ(cb_batch_init(&other, &ring, 0, 8, 1, 2), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_batch_init(&other, &ring, 9, 8, 1, 2), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_batch_init(&other, &ring, 1, 8, 3, 2), CB_ERROR_INVALID_PARAMETER);
+    EXPECT_EQ(cb_batch_init(NULL, &ring, 1, 8, 1, 2), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_batch_insert_bulk(&b, &item, 0, 0, &inserted), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_batch_flush(NULL), CB_ERROR_NULL_POINTER);
+
+    ASSERT_EQ(cb_batch_init(&other, &ring, 1000, 5000, 0, 0), CB_SUCCESS);
+    EXPECT_EQ(other.batch_max, (CbIndex)(BATCH_RING - 1));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
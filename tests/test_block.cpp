@@ -0,0 +1,130 @@
+#include "test_common.h"
+#include "cb_block.h"
+#include <string.h>
+
+#define BLOCK_ITEMS 256
+#define BLOCK_COUNT 4
+
+// Define BlockTest fixture
+class BlockTest : public ::testing::Test {
+protected:
+    cb_block_t blk;
+    CbItem storage[BLOCK_ITEMS * BLOCK_COUNT];
+    
+    void SetUp() override {
+        ASSERT_EQ(cb_block_init(&blk, storage, BLOCK_ITEMS * BLOCK_COUNT, BLOCK_ITEMS, 100), CB_SUCCESS);
+    }
+    
+    void TearDown() override {
+        // Reset buffer statistics
+        cb_reset_stats(&blk.ring);
+    }
+};
+
+// Records become visible only when their block closes
+TEST_F(BlockTest, BlockLevelPublication) {
+    char msg[32];
+    for (int i = 0; i < 5; i++) {
+        int len = snprintf(msg, sizeof(msg), "rec%d", i);
+        ASSERT_EQ(cb_block_write(&blk, msg, (size_t)len, 10 + i), CB_SUCCESS);
+    }
+    
+    cb_block_desc_t desc;
+    EXPECT_EQ(cb_block_acquire(&blk, &desc), CB_ERROR_BUFFER_EMPTY);
+    
+    ASSERT_EQ(cb_block_flush(&blk), CB_SUCCESS);
+    ASSERT_EQ(cb_block_acquire(&blk, &desc), CB_SUCCESS);
+    EXPECT_EQ(desc.header.seq, 0u);
+    EXPECT_EQ(desc.header.num_records, 5u);
+    EXPECT_EQ(desc.header.first_ts, 10u);
+    EXPECT_EQ(desc.header.last_ts, 14u);
+    EXPECT_EQ(desc.header.status, CB_BLOCK_CLOSED_FLUSH);
+    
+    size_t cursor = 0;
+    cb_block_record_t rec;
+    for (int i = 0; i < 5; i++) {
+        int len = snprintf(msg, sizeof(msg), "rec%d", i);
+        ASSERT_EQ(cb_block_next(&desc, &cursor, &rec), CB_SUCCESS);
+        ASSERT_EQ(rec.length, (uint32_t)len);
+        EXPECT_EQ(memcmp(rec.data, msg, rec.length), 0);
+        EXPECT_EQ(rec.timestamp, (uint64_t)(10 + i));
+    }
+    EXPECT_EQ(cb_block_next(&desc, &cursor, &rec), CB_ERROR_BUFFER_EMPTY);
+    
+    // One release retires the whole block
+    EXPECT_EQ(cb_block_release(&blk), CB_SUCCESS);
+    EXPECT_EQ(cb_dataSize(&blk.ring), 0);
+    EXPECT_EQ(cb_block_release(&blk), CB_ERROR_BUFFER_EMPTY);
+}
+
+// A full block closes automatically and the record goes to the next one
+TEST_F(BlockTest, CloseWhenFull) {
+    uint8_t payload[40];
+    memset(payload, 0x5A, sizeof(payload));
+    
+    // 32-byte block header, 56 bytes per record -> 4 records per 256-byte block
+    int written = 0;
+    while (cb_block_write(&blk, payload, sizeof(payload), written) == CB_SUCCESS) {
+        written++;
+    }
+    // One block always stays free, as one slot does in the core buffer
+    EXPECT_EQ(written, 4 * (BLOCK_COUNT - 1));
+    
+    cb_block_desc_t desc;
+    for (int b = 0; b < BLOCK_COUNT - 1; b++) {
+        ASSERT_EQ(cb_block_acquire(&blk, &desc), CB_SUCCESS);
+        EXPECT_EQ(desc.header.seq, (uint32_t)b);
+        EXPECT_EQ(desc.header.num_records, 4u);
+        EXPECT_EQ(desc.header.status, CB_BLOCK_CLOSED_FULL);
+        ASSERT_EQ(cb_block_release(&blk), CB_SUCCESS);
+    }
+    EXPECT_EQ(cb_block_acquire(&blk, &desc), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_block_flush(&blk), CB_ERROR_BUFFER_EMPTY);
+    
+    // Retired blocks are reused
+    ASSERT_EQ(cb_block_write(&blk, payload, sizeof(payload), 99), CB_SUCCESS);
+    ASSERT_EQ(cb_block_flush(&blk), CB_SUCCESS);
+    ASSERT_EQ(cb_block_acquire(&blk, &desc), CB_SUCCESS);
+    EXPECT_EQ(desc.header.seq, (uint32_t)(BLOCK_COUNT - 1));
+    EXPECT_EQ(desc.header.num_records, 1u);
+}
+
+// Low-rate traffic is closed by timeout
+TEST_F(BlockTest, TimeoutClose) {
+    ASSERT_EQ(cb_block_write(&blk, "x", 1, 1000), CB_SUCCESS);
+    EXPECT_EQ(cb_block_tick(&blk, 1050), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_block_tick(&blk, 1100), CB_SUCCESS);
+    
+    cb_block_desc_t desc;
+    ASSERT_EQ(cb_block_acquire(&blk, &desc), CB_SUCCESS);
+    EXPECT_EQ(desc.header.status, CB_BLOCK_CLOSED_TIMEOUT);
+    EXPECT_EQ(desc.header.num_records, 1u);
+    ASSERT_EQ(cb_block_release(&blk), CB_SUCCESS);
+    
+    // A late write also closes the expired block before appending
+    ASSERT_EQ(cb_block_write(&blk, "a", 1, 2000), CB_SUCCESS);
+    ASSERT_EQ(cb_block_write(&blk, "b", 1, 2200), CB_SUCCESS);
+    ASSERT_EQ(cb_block_acquire(&blk, &desc), CB_SUCCESS);
+    EXPECT_EQ(desc.header.num_records, 1u);
+    EXPECT_EQ(desc.header.first_ts, 2000u);
+    EXPECT_EQ(cb_block_tick(&blk, 2250), CB_ERROR_BUFFER_EMPTY);
+}
+
+// Invalid configurations and arguments
+TEST_F(BlockTest, InvalidArguments) {
+    cb_block_t other;
+    EXPECT_EQ(cb_block_init(&other, storage, 1000, BLOCK_ITEMS, 0), CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_block_init(&other, storage, BLOCK_ITEMS, BLOCK_ITEMS, 0), CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_block_init(&other, storage, 64, 16, 0), CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_block_init(nullptr, storage, 512, 256, 0), CB_ERROR_NULL_POINTER);
+    
+    uint8_t big[BLOCK_ITEMS];
+    EXPECT_EQ(cb_block_write(&blk, big, sizeof(big), 0), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_block_flush(&blk), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_block_write(&blk, nullptr, 4, 0), CB_ERROR_NULL_POINTER);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
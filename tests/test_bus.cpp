@@ -0,0 +1,173 @@
+#include "test_common.h"
+#include "cb_bus.h"
+#include <cstring>
+#include <string>
+
+#define BUS_RING 256
+
+// Define BusTest fixture
+class BusTest : public ::testing::Test {
+protected:
+    cb_bus_t bus;
+    cb_bus_sub_t subs[3] = {};
+    CbItem storage[3][BUS_RING];
+
+    void SetUp() override {
+        ASSERT_EQ(cb_bus_init(&bus), CB_SUCCESS);
+    }
+
+    void TearDown() override {
+        // Reset buffer statistics
+        for (auto &sub : subs) {
+            cb_reset_stats(&sub.ring);
+        }
+    }
+
+    std::string receive(cb_bus_sub_t *sub) {
+        char buf[64];
+        size_t length = 0;
+        if (cb_bus_receive(sub, buf, sizeof(buf), &length) != CB_SUCCESS) {
+            return "<none>";
+        }
+        return std::string(buf, length);
+    }
+};
+
+// Topic names resolve to stable handles
+TEST_F(BusTest, TopicHandles) {
+    cb_bus_topic_t *a, *b, *again;
+    ASSERT_EQ(cb_bus_topic(&bus, "sensors/imu", &a), CB_SUCCESS);
+    ASSERT_EQ(cb_bus_topic(&bus, "sensors/gps", &b), CB_SUCCESS);
+    ASSERT_EQ(cb_bus_topic(&bus, "sensors/imu", &again), CB_SUCCESS);
+    EXPECT_EQ(a, again);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(bus.topic_count, 2u);
+}
+
+// Every subscriber gets its own copy, in order
+TEST_F(BusTest, FanOut) {
+    cb_bus_topic_t *t, *other;
+    ASSERT_EQ(cb_bus_topic(&bus, "log", &t), CB_SUCCESS);
+    ASSERT_EQ(cb_bus_topic(&bus, "other", &other), CB_SUCCESS);
+    ASSERT_EQ(cb_bus_subscribe(t, &subs[0], storage[0], BUS_RING), CB_SUCCESS);
+    ASSERT_EQ(cb_bus_subscribe(t, &subs[1], storage[1], BUS_RING), CB_SUCCESS);
+    ASSERT_EQ(cb_bus_subscribe(other, &subs[2], storage[2], BUS_RING), CB_SUCCESS);
+
+    unsigned delivered;
+    ASSERT_EQ(cb_bus_publish(t, "hello", 5, &delivered), CB_SUCCESS);
+    EXPECT_EQ(delivered, 2u);
+    ASSERT_EQ(cb_bus_publish(t, "world!", 6, &delivered), CB_SUCCESS);
+
+    EXPECT_EQ(receive(&subs[0]), "hello");
+    EXPECT_EQ(receive(&subs[1]), "hello");
+    EXPECT_EQ(receive(&subs[0]), "world!");
+    EXPECT_EQ(receive(&subs[1]), "world!");
+    EXPECT_EQ(receive(&subs[2]), "<none>");
+
+    cb_bus_topic_stats_t ts;
+    ASSERT_EQ(cb_bus_topic_stats(t, &ts), CB_SUCCESS);
+    EXPECT_EQ(ts.published, 2u);
+    EXPECT_EQ(ts.delivered, 4u);
+    EXPECT_EQ(ts.dropped, 0u);
+    EXPECT_EQ(ts.subscribers, 2u);
+}
+
+// A full subscriber drops messages without affecting the others
+TEST_F(BusTest, SlowSubscriberDrops) {
+    cb_bus_topic_t *t;
+    ASSERT_EQ(cb_bus_topic(&bus, "fast", &t), CB_SUCCESS);
+    ASSERT_EQ(cb_bus_subscribe(t, &subs[0], storage[0], BUS_RING), CB_SUCCESS);
+    ASSERT_EQ(cb_bus_subscribe(t, &subs[1], storage[1], 32), CB_SUCCESS);
+
+    char msg[16];
+    for (int i = 0; i < 20; i++) {
+        snprintf(msg, sizeof(msg), "m%02d", i);
+        ASSERT_EQ(cb_bus_publish(t, msg, 3, NULL), CB_SUCCESS);
+        EXPECT_EQ(receive(&subs[0]), std::string(msg, 3));
+    }
+
+    cb_bus_sub_stats_t slow;
+    ASSERT_EQ(cb_bus_sub_stats(&subs[1], &slow), CB_SUCCESS);
+    EXPECT_GT(slow.delivered, 0u);
+    EXPECT_GT(slow.dropped, 0u);
+    EXPECT_EQ(slow.delivered + slow.dropped, 20u);
+    EXPECT_EQ(slow.received, 0u);
+
+    cb_bus_sub_stats_t fast;
+    ASSERT_EQ(cb_bus_sub_stats(&subs[0], &fast), CB_SUCCESS);
+    EXPECT_EQ(fast.delivered, 20u);
+    EXPECT_EQ(fast.received, 20u);
+
+    cb_bus_topic_stats_t ts;
+    ASSERT_EQ(cb_bus_topic_stats(t, &ts), CB_SUCCESS);
+    EXPECT_EQ(ts.dropped, slow.dropped);
+    EXPECT_EQ(ts.delivered, 20u + slow.delivered);
+
+    // The slow subscriber still reads the oldest messages it kept
+    EXPECT_EQ(receive(&subs[1]), "m00");
+}
+
+// Unsubscribed rings stop receiving
+TEST_F(BusTest, Unsubscribe) {
+    cb_bus_topic_t *t;
+    ASSERT_EQ(cb_bus_topic(&bus, "x", &t), CB_SUCCESS);
+    ASSERT_EQ(cb_bus_subscribe(t, &subs[0], storage[0], BUS_RING), CB_SUCCESS);
+    ASSERT_EQ(cb_bus_subscribe(t, &subs[1], storage[1], BUS_RING), CB_SUCCESS);
+    ASSERT_EQ(cb_bus_unsubscribe(t, &subs[0]), CB_SUCCESS);
+    EXPECT_EQ(cb_bus_unsubscribe(t, &subs[0]), CB_ERROR_INVALID_PARAMETER);
+
+    ASSERT_EQ(cb_bus_publish(t, "a", 1, NULL), CB_SUCCESS);
+    EXPECT_EQ(receive(&subs[0]), "<none>");
+    EXPECT_EQ(receive(&subs[1]), "a");
+}
+
+// A subscriber attached to one topic cannot join another until it leaves
+TEST_F(BusTest, OneTopicPerSubscriber) {
+    cb_bus_topic_t *a, *b;
+    ASSERT_EQ(cb_bus_topic(&bus, "a", &a), CB_SUCCESS);
+    ASSERT_EQ(cb_bus_topic(&bus, "b", &b), CB_SUCCESS);
+    ASSERT_EQ(cb_bus_subscribe(a, &subs[0], storage[0], BUS_RING), CB_SUCCESS);
+    ASSERT_EQ(cb_bus_publish(a, "kept", 4, NULL), CB_SUCCESS);
+
+    EXPECT_EQ(cb_bus_subscribe(b, &subs[0], storage[1], BUS_RING), CB_ERROR_INVALID_PARAMETER);
+    EXPECT_EQ(cb_bus_unsubscribe(b, &subs[0]), CB_ERROR_INVALID_PARAMETER);
+    EXPECT_EQ(receive(&subs[0]), "kept");
+
+    ASSERT_EQ(cb_bus_unsubscribe(a, &subs[0]), CB_SUCCESS);
+    ASSERT_EQ(cb_bus_subscribe(b, &subs[0], storage[0], BUS_RING), CB_SUCCESS);
+    ASSERT_EQ(cb_bus_publish(b, "moved", 5, NULL), CB_SUCCESS);
+    EXPECT_EQ(receive(&subs[0]), "moved");
+    EXPECT_EQ(a->sub_count, 0u);
+}
+
+// Invalid arguments and limits
+TEST_F(BusTest, Errors) {
+    cb_bus_topic_t *t;
+    char long_name[CB_BUS_NAME_LENGTH + 1];
+    memset(long_name, 'n', sizeof(long_name) - 1);
+    long_name[sizeof(long_name) - 1] = '\0';
+
+    EXPECT_EQ(cb_bus_topic(&bus, "", &t), CB_ERROR_INVALID_PARAMETER);
+    EXPECT_EQ(cb_bus_topic(&bus, long_name, &t), CB_ERROR_INVALID_PARAMETER);
+    EXPECT_EQ(cb_bus_topic(NULL, "a", &t), CB_ERROR_NULL_POINTER);
+
+    ASSERT_EQ(cb_bus_topic(&bus, "t", &t), CB_SUCCESS);
+    ASSERT_EQ(cb_bus_subscribe(t, &subs[0], storage[0], BUS_RING), CB_SUCCESS);
+    EXPECT_EQ(cb_bus_subscribe(t, &subs[0], storage[0], BUS_RING), CB_ERROR_INVALID_PARAMETER);
+
+    for (int i = 0; i < CB_BUS_MAX_TOPICS + 1; i++) {
+        char name[16];
+        snprintf(name, sizeof(name), "topic%d", i);
+        cb_result_t result = cb_bus_topic(&bus, name, &t);
+        if (i < CB_BUS_MAX_TOPICS - 1) {
+            ASSERT_EQ(result, CB_SUCCESS);
+        } else {
+            ASSERT_EQ(result, CB_ERROR_BUFFER_FULL);
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,179 @@
+#include "test_common.h"
+#include "cb_delta.h"
+#include <math.h>
+
+#define DELTA_BLOCK_ITEMS 256
+#define DELTA_BLOCK_COUNT 16
+#define DELTA_STORAGE (DELTA_BLOCK_ITEMS * DELTA_BLOCK_COUNT)
+
+// Slowly varying sensor-like signal
+static uint32_t sample_at(uint64_t i) {
+    return 20000u + (uint32_t)(1000.0 * sin((double)i / 50.0)) + (uint32_t)(i % 7);
+}
+
+// Define DeltaTest fixture
+class DeltaTest : public ::testing::Test {
+protected:
+    cb_delta_t d;
+    CbItem storage[DELTA_STORAGE];
+
+    void SetUp() override {
+        ASSERT_EQ(cb_delta_init(&d, storage, DELTA_STORAGE, DELTA_BLOCK_ITEMS), CB_SUCCESS);
+    }
+
+    void TearDown() override {
+        // Reset buffer statistics
+        cb_reset_stats(&d.ring);
+    }
+};
+
+// Samples come back in order and exactly
+TEST_F(DeltaTest, PushPopRoundTrip) {
+    for (uint64_t i = 0; i < 1000; i++) {
+        ASSERT_EQ(cb_delta_push(&d, sample_at(i)), CB_SUCCESS);
+    }
+    EXPECT_EQ(cb_delta_count(&d), 1000u);
+
+    uint32_t value;
+    ASSERT_EQ(cb_delta_peek(&d, &value), CB_SUCCESS);
+    EXPECT_EQ(value, sample_at(0));
+
+    for (uint64_t i = 0; i < 1000; i++) {
+        ASSERT_EQ(cb_delta_pop(&d, &value), CB_SUCCESS);
+        ASSERT_EQ(value, sample_at(i));
+    }
+    EXPECT_EQ(cb_delta_pop(&d, &value), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_delta_count(&d), 0u);
+}
+
+// Slowly varying samples need far less than four bytes each
+TEST_F(DeltaTest, CompressionRatio) {
+    uint64_t stored = 0;
+    while (cb_delta_push(&d, sample_at(stored)) == CB_SUCCESS) {
+        stored++;
+    }
+
+    size_t raw_capacity = sizeof(storage) / sizeof(uint32_t);
+    EXPECT_GE(stored, 3 * raw_capacity);
+    EXPECT_EQ(cb_delta_count(&d), stored);
+
+    uint32_t value;
+    for (uint64_t i = 0; i < stored; i++) {
+        ASSERT_EQ(cb_delta_pop(&d, &value), CB_SUCCESS);
+        ASSERT_EQ(value, sample_at(i));
+    }
+}
+
+// Large and wrapping deltas still round-trip
+TEST_F(DeltaTest, ExtremeDeltas) {
+    const uint32_t values[] = { 0u, UINT32_MAX, 0u, 0x80000000u, 0x7FFFFFFFu, 1u, UINT32_MAX - 1u };
+    const size_t n = sizeof(values) / sizeof(values[0]);
+
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(cb_delta_push(&d, values[i]), CB_SUCCESS);
+    }
+
+    uint32_t value;
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(cb_delta_pop(&d, &value), CB_SUCCESS);
+        EXPECT_EQ(value, values[i]);
+    }
+}
+
+// Random access and skips go through the block index
+TEST_F(DeltaTest, SeekAndSkip) {
+    const uint64_t total = 3000;
+    for (uint64_t i = 0; i < total; i++) {
+        ASSERT_EQ(cb_delta_push(&d, sample_at(i)), CB_SUCCESS);
+    }
+
+    uint32_t value;
+    const uint64_t probes[] = { 0, 1, 499, 1500, 2222, total - 1 };
+    for (uint64_t idx : probes) {
+        ASSERT_EQ(cb_delta_get(&d, idx, &value), CB_SUCCESS);
+        EXPECT_EQ(value, sample_at(idx));
+    }
+    EXPECT_EQ(cb_delta_get(&d, total, &value), CB_ERROR_BUFFER_EMPTY);
+
+    // Pop a few, then index relative to the new oldest sample
+    for (int i = 0; i < 3; i++) {
+        ASSERT_EQ(cb_delta_pop(&d, &value), CB_SUCCESS);
+    }
+    ASSERT_EQ(cb_delta_get(&d, 10, &value), CB_SUCCESS);
+    EXPECT_EQ(value, sample_at(13));
+
+    // Skip across several blocks
+    ASSERT_EQ(cb_delta_skip(&d, 2000), CB_SUCCESS);
+    EXPECT_EQ(cb_delta_count(&d), total - 2003);
+    ASSERT_EQ(cb_delta_pop(&d, &value), CB_SUCCESS);
+    EXPECT_EQ(value, sample_at(2003));
+
+    EXPECT_EQ(cb_delta_skip(&d, total), CB_ERROR_INVALID_COUNT);
+    ASSERT_EQ(cb_delta_skip(&d, cb_delta_count(&d)), CB_SUCCESS);
+    EXPECT_EQ(cb_delta_count(&d), 0u);
+}
+
+// The consumer can drain the open block and continue as it fills
+TEST_F(DeltaTest, InterleavedPushPop) {
+    uint64_t pushed = 0;
+    uint64_t popped = 0;
+    uint32_t value;
+
+    for (int round = 0; round < 200; round++) {
+        for (int i = 0; i < 37; i++) {
+            ASSERT_EQ(cb_delta_push(&d, sample_at(pushed++)), CB_SUCCESS);
+        }
+        while (cb_delta_pop(&d, &value) == CB_SUCCESS) {
+            ASSERT_EQ(value, sample_at(popped++));
+        }
+        ASSERT_EQ(popped, pushed);
+    }
+}
+
+// With overwrite enabled the oldest block is dropped and the newest history kept
+TEST_F(DeltaTest, OverwriteKeepsNewest) {
+    cb_set_overwrite(&d.ring, true);
+
+    const uint64_t total = 100000;
+    for (uint64_t i = 0; i < total; i++) {
+        ASSERT_EQ(cb_delta_push(&d, sample_at(i)), CB_SUCCESS);
+    }
+
+    uint64_t kept = cb_delta_count(&d);
+    ASSERT_GT(kept, 0u);
+    ASSERT_LT(kept, total);
+
+    uint32_t value;
+    ASSERT_EQ(cb_delta_get(&d, kept - 1, &value), CB_SUCCESS);
+    EXPECT_EQ(value, sample_at(total - 1));
+
+    for (uint64_t i = total - kept; i < total; i++) {
+        ASSERT_EQ(cb_delta_pop(&d, &value), CB_SUCCESS);
+        ASSERT_EQ(value, sample_at(i));
+    }
+    EXPECT_EQ(cb_delta_count(&d), 0u);
+}
+
+// Invalid arguments are rejected
+TEST_F(DeltaTest, Errors) {
+    cb_delta_t other;
+    uint32_t value;
+
+    EXPECT_EQ(cb_delta_init(NULL, storage, DELTA_STORAGE, DELTA_BLOCK_ITEMS), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_delta_init(&other, storage, DELTA_STORAGE, 0), CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_delta_init(&other, storage, DELTA_STORAGE, DELTA_STORAGE), CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_delta_init(&other, storage, DELTA_STORAGE - 1, DELTA_BLOCK_ITEMS), CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_delta_init(&other, storage, DELTA_STORAGE, 4), CB_ERROR_INVALID_SIZE);
+
+    EXPECT_EQ(cb_delta_push(NULL, 1), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_delta_pop(&d, NULL), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_delta_peek(&d, &value), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_delta_get(&d, 0, &value), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_delta_skip(&d, 1), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_delta_count(NULL), 0u);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,115 @@
+#include "test_common.h"
+#include "cb_dgram.h"
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Define DgramTest fixture
+class DgramTest : public ::testing::Test {
+protected:
+    cb tx;
+    cb rx;
+    CbItem tx_storage[4096];
+    CbItem rx_storage[4096];
+    int sv[2];
+    
+    void SetUp() override {
+        cb_init(&tx, tx_storage, 4096);
+        cb_init(&rx, rx_storage, 4096);
+        ASSERT_EQ(socketpair(AF_UNIX, SOCK_DGRAM, 0, sv), 0);
+    }
+    
+    void TearDown() override {
+        close(sv[0]);
+        close(sv[1]);
+    }
+};
+
+// Records cross a socket pair in batches and keep their boundaries
+TEST_F(DgramTest, SendRecvBatch) {
+    char msg[64];
+    for (int i = 0; i < 40; i++) {
+        int len = snprintf(msg, sizeof(msg), "record-%d", i);
+        ASSERT_EQ(cb_record_write(&tx, msg, (size_t)len), CB_SUCCESS);
+    }
+    
+    unsigned sent = 0;
+    ASSERT_EQ(cb_dgram_send(&tx, sv[0], 16, &sent), CB_SUCCESS);
+    EXPECT_EQ(sent, 16u);
+    ASSERT_EQ(cb_dgram_send(&tx, sv[0], 64, &sent), CB_SUCCESS);
+    EXPECT_EQ(sent, 24u);
+    EXPECT_EQ(cb_dataSize(&tx), 0);
+    EXPECT_EQ(cb_dgram_send(&tx, sv[0], 64, &sent), CB_ERROR_BUFFER_EMPTY);
+    
+    unsigned received = 0;
+    unsigned total = 0;
+    while (total < 40) {
+        ASSERT_EQ(cb_dgram_recv(&rx, sv[1], 64, 32, &received), CB_SUCCESS);
+        total += received;
+    }
+    EXPECT_EQ(cb_dgram_recv(&rx, sv[1], 64, 32, &received), CB_ERROR_BUFFER_EMPTY);
+    
+    char out[64];
+    size_t length = 0;
+    for (int i = 0; i < 40; i++) {
+        int len = snprintf(msg, sizeof(msg), "record-%d", i);
+        ASSERT_EQ(cb_record_read(&rx, out, sizeof(out), &length), CB_SUCCESS);
+        ASSERT_EQ(length, (size_t)len);
+        EXPECT_EQ(memcmp(out, msg, length), 0);
+    }
+    EXPECT_EQ(cb_dataSize(&rx), 0);
+}
+
+// Received records can be forwarded again straight from ring storage
+TEST_F(DgramTest, ForwardWrapped) {
+    char payload[200];
+    for (int round = 0; round < 100; round++) {
+        memset(payload, 'a' + round % 26, sizeof(payload));
+        ASSERT_EQ(cb_record_write(&tx, payload, 1 + round % 200), CB_SUCCESS);
+        
+        unsigned n = 0;
+        ASSERT_EQ(cb_dgram_send(&tx, sv[0], 8, &n), CB_SUCCESS);
+        ASSERT_EQ(n, 1u);
+        ASSERT_EQ(cb_dgram_recv(&rx, sv[1], 8, 256, &n), CB_SUCCESS);
+        ASSERT_EQ(n, 1u);
+        
+        // Echo back through the other direction
+        ASSERT_EQ(cb_dgram_send(&rx, sv[1], 8, &n), CB_SUCCESS);
+        ASSERT_EQ(n, 1u);
+        
+        char out[256];
+        ssize_t got = recv(sv[0], out, sizeof(out), 0);
+        ASSERT_EQ(got, 1 + round % 200);
+        EXPECT_EQ(out[got - 1], 'a' + round % 26);
+    }
+}
+
+// Oversized datagrams are truncated to the slot size
+TEST_F(DgramTest, Truncation) {
+    char big[100];
+    memset(big, 'x', sizeof(big));
+    ASSERT_EQ(send(sv[0], big, sizeof(big), 0), (ssize_t)sizeof(big));
+    
+    unsigned n = 0;
+    ASSERT_EQ(cb_dgram_recv(&rx, sv[1], 4, 16, &n), CB_SUCCESS);
+    EXPECT_EQ(n, 1u);
+    
+    size_t length = 0;
+    EXPECT_EQ(cb_record_peek_length(&rx, &length), CB_SUCCESS);
+    EXPECT_EQ(length, 16u);
+}
+
+// Invalid arguments
+TEST_F(DgramTest, InvalidArguments) {
+    unsigned n = 0;
+    EXPECT_EQ(cb_dgram_send(nullptr, sv[0], 1, &n), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_dgram_send(&tx, sv[0], 0, &n), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_dgram_recv(&rx, sv[1], 1, 0, &n), CB_ERROR_INVALID_COUNT);
+    ASSERT_EQ(cb_record_write(&tx, "x", 1), CB_SUCCESS);
+    EXPECT_EQ(cb_dgram_send(&tx, -1, 1, &n), CB_ERROR_IO);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
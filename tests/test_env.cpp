@@ -0,0 +1,157 @@
+#include "test_common.h"
+#include "cb_env.h"
+#include <vector>
+
+#define ENV_RING 5000
+#define ENV_BASE_SHIFT 3
+#define ENV_FACTOR_SHIFT 2
+#define ENV_LEVELS 4
+
+// Define EnvTest fixture
+class EnvTest : public ::testing::Test {
+protected:
+    cb ring;
+    cb_env_t env;
+    CbItem storage[ENV_RING];
+    std::vector<cb_env_entry_t> entries;
+    uint32_t rng = 12345;
+    int level = 60;
+
+    void SetUp() override {
+        ASSERT_EQ(cb_init_ex(&ring, storage, ENV_RING), CB_SUCCESS);
+        entries.resize(cb_env_entries(ENV_RING, ENV_BASE_SHIFT, ENV_FACTOR_SHIFT, ENV_LEVELS));
+        ASSERT_EQ(cb_env_init(&env, &ring, entries.data(), entries.size(),
+                              ENV_BASE_SHIFT, ENV_FACTOR_SHIFT, ENV_LEVELS), CB_SUCCESS);
+    }
+
+    void TearDown() override {
+        // Reset buffer statistics
+        cb_reset_stats(&ring);
+    }
+
+    // Random walk, so that envelopes differ between neighbouring ranges
+    CbItem next_item() {
+        rng = rng * 1103515245u + 12345u;
+        level += (int)((rng >> 16) % 7) - 3;
+        level = std::max(0, std::min(120, level));
+        return (CbItem)level;
+    }
+
+    // Brute-force envelope of a range, for comparison
+    cb_env_entry_t scan(CbIndex offset, CbIndex count) {
+        cb_env_entry_t e;
+        cb_peek_ex(&ring, offset, &e.min);
+        e.max = e.min;
+        for (CbIndex i = 1; i < count; i++) {
+            CbItem item;
+            cb_peek_ex(&ring, offset + i, &item);
+            if (item < e.min) e.min = item;
+            if (item > e.max) e.max = item;
+        }
+        return e;
+    }
+
+    void check_pixels(CbIndex offset, CbIndex count, unsigned pixels) {
+        std::vector<cb_env_entry_t> out(pixels);
+        ASSERT_EQ(cb_env_query(&env, offset, count, pixels, out.data()), CB_SUCCESS);
+        for (unsigned p = 0; p < pixels; p++) {
+            CbIndex lo = (CbIndex)((uint64_t)count * p / pixels);
+            CbIndex hi = (CbIndex)((uint64_t)count * (p + 1) / pixels);
+            cb_env_entry_t ref = scan(offset + lo, hi - lo);
+            ASSERT_EQ(out[p].min, ref.min) << "offset=" << offset << " count=" << count << " p=" << p;
+            ASSERT_EQ(out[p].max, ref.max) << "offset=" << offset << " count=" << count << " p=" << p;
+        }
+    }
+};
+
+// Queries over a partly filled ring match a full scan
+TEST_F(EnvTest, MatchesScan) {
+    for (int i = 0; i < 3001; i++) {
+        ASSERT_EQ(cb_env_insert(&env, next_item()), CB_SUCCESS);
+    }
+
+    check_pixels(0, 3001, 1);
+    check_pixels(0, 3001, 100);
+    check_pixels(17, 2000, 33);
+    check_pixels(3000, 1, 1);
+    check_pixels(5, 7, 7);
+}
+
+// Overwrite eviction and consumer removal never leave stale blocks in answers
+TEST_F(EnvTest, ConsistentUnderEviction) {
+    cb_set_overwrite(&ring, true);
+
+    std::vector<CbItem> batch(777);
+    for (int round = 0; round < 40; round++) {
+        for (auto &item : batch) {
+            item = next_item();
+        }
+        CbIndex inserted = 0;
+        ASSERT_EQ(cb_env_insert_bulk(&env, batch.data(), (CbIndex)batch.size(), &inserted), CB_SUCCESS);
+
+        if (round % 7 == 3) {
+            CbItem sink[123];
+            CbIndex removed;
+            cb_remove_bulk_ex(&ring, sink, 123, &removed);
+        }
+
+        CbIndex stored = cb_dataSize(&ring);
+        check_pixels(0, stored, 64);
+        check_pixels(stored / 3, stored - stored / 3, 10);
+    }
+}
+
+// A ring with items already stored is indexed at init
+TEST_F(EnvTest, AttachToFilledRing) {
+    cb other;
+    CbItem other_storage[300];
+    ASSERT_EQ(cb_init_ex(&other, other_storage, 300), CB_SUCCESS);
+    for (int i = 0; i < 200; i++) {
+        cb_insert(&other, next_item());
+    }
+
+    cb_env_t env2;
+    std::vector<cb_env_entry_t> e2(cb_env_entries(300, 2, 2, 3));
+    ASSERT_EQ(cb_env_init(&env2, &other, e2.data(), e2.size(), 2, 2, 3), CB_SUCCESS);
+
+    cb_env_entry_t out[4];
+    ASSERT_EQ(cb_env_query(&env2, 0, 200, 4, out), CB_SUCCESS);
+    for (int p = 0; p < 4; p++) {
+        CbItem lo = 255, hi = 0;
+        for (int i = p * 50; i < (p + 1) * 50; i++) {
+            CbItem item;
+            cb_peek_ex(&other, (CbIndex)i, &item);
+            lo = std::min(lo, item);
+            hi = std::max(hi, item);
+        }
+        EXPECT_EQ(out[p].min, lo);
+        EXPECT_EQ(out[p].max, hi);
+    }
+    cb_reset_stats(&other);
+}
+
+// Invalid arguments are rejected
+TEST_F(EnvTest, Errors) {
+    cb_env_entry_t out[2];
+    cb_env_t other;
+
+    EXPECT_EQ(cb_env_init(&other, &ring, entries.data(), 1, ENV_BASE_SHIFT, ENV_FACTOR_SHIFT, ENV_LEVELS),
+              CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_env_init(&other, &ring, entries.data(), entries.size(), ENV_BASE_SHIFT, 0, ENV_LEVELS),
+              CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_env_init(&other, &ring, entries.data(), entries.size(), ENV_BASE_SHIFT, ENV_FACTOR_SHIFT, 0),
+              CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_env_init(NULL, &ring, entries.data(), entries.size(), 1, 1, 1), CB_ERROR_NULL_POINTER);
+
+    EXPECT_EQ(cb_env_query(&env, 0, 1, 1, out), CB_ERROR_BUFFER_EMPTY);
+    ASSERT_EQ(cb_env_insert(&env, 1), CB_SUCCESS);
+    EXPECT_EQ(cb_env_query(&env, 0, 1, 2, out), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_env_query(&env, 0, 1, 0, out), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_env_query(&env, 1, 1, 1, out), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_env_query(&env, 0, 1, 1, NULL), CB_ERROR_NULL_POINTER);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,188 @@
+#include "test_common.h"
+#include "cb_fir.h"
+#include <math.h>
+#include <vector>
+
+#define FIR_IN_SAMPLES  100
+#define FIR_OUT_SAMPLES 37
+
+// Define FirTest fixture: float and int16 rings for input and output
+class FirTest : public ::testing::Test {
+protected:
+    cb_fir_t fir;
+    cb in;
+    cb out;
+    alignas(32) CbItem in_storage[FIR_IN_SAMPLES * sizeof(float) / sizeof(CbItem)];
+    alignas(32) CbItem out_storage[FIR_OUT_SAMPLES * sizeof(float) / sizeof(CbItem)];
+
+    void SetUp() override {
+        // Reset buffer statistics
+        cb_reset_stats(&in);
+        cb_reset_stats(&out);
+    }
+
+    void init_rings(size_t sample_size) {
+        ASSERT_EQ(cb_init_ex(&in, in_storage, (CbIndex)(FIR_IN_SAMPLES * sample_size / sizeof(CbItem))), CB_SUCCESS);
+        ASSERT_EQ(cb_init_ex(&out, out_storage, (CbIndex)(FIR_OUT_SAMPLES * sample_size / sizeof(CbItem))), CB_SUCCESS);
+    }
+
+    // Push samples as raw bytes, as a producer on a byte ring would
+    CbIndex push(const void *samples, size_t count, size_t sample_size) {
+        CbIndex items = (CbIndex)(count * sample_size / sizeof(CbItem));
+        CbIndex space = cb_freeSpace(&in) / (CbIndex)(sample_size / sizeof(CbItem)) * (CbIndex)(sample_size / sizeof(CbItem));
+        if (items > space) {
+            items = space;
+        }
+        CbIndex inserted = 0;
+        if (items > 0) {
+            cb_insert_bulk_ex(&in, (const CbItem *)samples, items, &inserted);
+        }
+        return inserted / (CbIndex)(sample_size / sizeof(CbItem));
+    }
+
+    size_t pull(void *samples, size_t max, size_t sample_size) {
+        CbIndex removed = 0;
+        CbIndex items = (CbIndex)(max * sample_size / sizeof(CbItem));
+        if (cb_remove_bulk_ex(&out, (CbItem *)samples, items, &removed) != CB_SUCCESS) {
+            return 0;
+        }
+        return removed / (sample_size / sizeof(CbItem));
+    }
+};
+
+// Float filter matches direct convolution across many wrap points
+TEST_F(FirTest, FloatMatchesReference) {
+    const unsigned taps = 21;
+    std::vector<float> h(taps);
+    for (unsigned k = 0; k < taps; k++) {
+        h[k] = (float)(k + 1) / 100.0f;
+    }
+    ASSERT_EQ(cb_fir_init_f32(&fir, h.data(), taps), CB_SUCCESS);
+    init_rings(sizeof(float));
+
+    const size_t total = 5000;
+    std::vector<float> x(total), y;
+    for (size_t i = 0; i < total; i++) {
+        x[i] = (float)sin((double)i * 0.05) + (float)(i % 5) * 0.1f;
+    }
+
+    size_t fed = 0;
+    float buf[FIR_OUT_SAMPLES];
+    while (y.size() < total - taps + 1) {
+        fed += push(x.data() + fed, std::min<size_t>(13 + fed % 17, total - fed), sizeof(float));
+        CbIndex produced = 0;
+        cb_fir_process(&fir, &in, &out, 1000, &produced);
+        size_t got = pull(buf, 11 + y.size() % 23, sizeof(float));
+        y.insert(y.end(), buf, buf + got);
+        size_t more;
+        while ((more = pull(buf, FIR_OUT_SAMPLES, sizeof(float))) > 0) {
+            y.insert(y.end(), buf, buf + more);
+        }
+    }
+
+    ASSERT_EQ(y.size(), total - taps + 1);
+    for (size_t n = taps - 1; n < total; n++) {
+        double ref = 0.0;
+        for (unsigned k = 0; k < taps; k++) {
+            ref += (double)h[k] * (double)x[n - k];
+        }
+        ASSERT_NEAR(y[n - (taps - 1)], ref, 1e-4) << "n=" << n;
+    }
+
+    // The delay line stays in the input ring
+    EXPECT_EQ(cb_dataSize(&in), (CbIndex)((taps - 1) * sizeof(float) / sizeof(CbItem)));
+}
+
+// Q15 filter is bit-exact against the reference arithmetic
+TEST_F(FirTest, Q15MatchesReference) {
+    const unsigned taps = 16;
+    std::vector<int16_t> h(taps);
+    for (unsigned k = 0; k < taps; k++) {
+        h[k] = (int16_t)(2048 - (int)k * 100);
+    }
+    ASSERT_EQ(cb_fir_init_q15(&fir, h.data(), taps), CB_SUCCESS);
+    init_rings(sizeof(int16_t));
+
+    const size_t total = 4000;
+    std::vector<int16_t> x(total), y;
+    for (size_t i = 0; i < total; i++) {
+        x[i] = (int16_t)(8000.0 * sin((double)i * 0.03) + (double)((i * 7919) % 2001) - 1000.0);
+    }
+
+    size_t fed = 0;
+    int16_t buf[FIR_OUT_SAMPLES * 2];
+    while (y.size() < total - taps + 1) {
+        fed += push(x.data() + fed, std::min<size_t>(29 + fed % 31, total - fed), sizeof(int16_t));
+        CbIndex produced = 0;
+        cb_fir_process(&fir, &in, &out, 1000, &produced);
+        size_t got;
+        while ((got = pull(buf, FIR_OUT_SAMPLES * 2, sizeof(int16_t))) > 0) {
+            y.insert(y.end(), buf, buf + got);
+        }
+    }
+
+    ASSERT_EQ(y.size(), total - taps + 1);
+    for (size_t n = taps - 1; n < total; n++) {
+        int32_t acc = 0;
+        for (unsigned k = 0; k < taps; k++) {
+            acc += (int32_t)h[k] * (int32_t)x[n - k];
+        }
+        int32_t v = (acc + (1 << 14)) >> 15;
+        v = std::max<int32_t>(INT16_MIN, std::min<int32_t>(INT16_MAX, v));
+        ASSERT_EQ(y[n - (taps - 1)], (int16_t)v) << "n=" << n;
+    }
+}
+
+// Output is limited by the output ring and max_samples
+TEST_F(FirTest, Limits) {
+    const float h[3] = { 1.0f, 1.0f, 1.0f };
+    ASSERT_EQ(cb_fir_init_f32(&fir, h, 3), CB_SUCCESS);
+    init_rings(sizeof(float));
+
+    float x[50];
+    for (int i = 0; i < 50; i++) {
+        x[i] = (float)i;
+    }
+    ASSERT_EQ(push(x, 2, sizeof(float)), 2);
+
+    CbIndex produced = 0;
+    EXPECT_EQ(cb_fir_process(&fir, &in, &out, 10, &produced), CB_ERROR_BUFFER_EMPTY);
+    ASSERT_EQ(push(x + 2, 48, sizeof(float)), 48);
+
+    ASSERT_EQ(cb_fir_process(&fir, &in, &out, 5, &produced), CB_SUCCESS);
+    EXPECT_EQ(produced, 5);
+    ASSERT_EQ(cb_fir_process(&fir, &in, &out, 1000, &produced), CB_SUCCESS);
+    EXPECT_EQ(produced, (CbIndex)(FIR_OUT_SAMPLES - 1 - 5));
+    EXPECT_EQ(cb_fir_process(&fir, &in, &out, 1000, &produced), CB_ERROR_BUFFER_FULL);
+
+    float y[2];
+    ASSERT_EQ(pull(y, 2, sizeof(float)), 2u);
+    EXPECT_FLOAT_EQ(y[0], 0.0f + 1.0f + 2.0f);
+    EXPECT_FLOAT_EQ(y[1], 1.0f + 2.0f + 3.0f);
+}
+
+// Invalid arguments are rejected
+TEST_F(FirTest, Errors) {
+    const float h[2] = { 0.5f, 0.5f };
+    CbIndex produced;
+
+    EXPECT_EQ(cb_fir_init_f32(NULL, h, 2), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_fir_init_f32(&fir, h, 0), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_fir_init_f32(&fir, h, CB_FIR_MAX_TAPS + 1), CB_ERROR_INVALID_COUNT);
+
+    ASSERT_EQ(cb_fir_init_f32(&fir, h, 2), CB_SUCCESS);
+    init_rings(sizeof(float));
+    EXPECT_EQ(cb_fir_process(&fir, NULL, &out, 1, &produced), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_fir_process(&fir, &in, &out, 0, &produced), CB_ERROR_INVALID_COUNT);
+
+    if (sizeof(float) > sizeof(CbItem)) {
+        cb odd;
+        ASSERT_EQ(cb_init_ex(&odd, in_storage, 7), CB_SUCCESS);
+        EXPECT_EQ(cb_fir_process(&fir, &odd, &out, 1, &produced), CB_ERROR_INVALID_SIZE);
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,165 @@
+#include "test_common.h"
+#include "cb_frame.h"
+#include <vector>
+
+#define FRAME_RING 1024
+
+// Define FrameTest fixture
+class FrameTest : public ::testing::Test {
+protected:
+    cb ring;
+    CbItem storage[FRAME_RING];
+    uint32_t rng = 4242;
+
+    void SetUp() override {
+        ASSERT_EQ(cb_init_ex(&ring, storage, FRAME_RING), CB_SUCCESS);
+    }
+
+    void TearDown() override {
+        // Reset buffer statistics
+        cb_reset_stats(&ring);
+    }
+
+    // Payload rich in delimiter and escape bytes
+    std::vector<uint8_t> payload(size_t length) {
+        static const uint8_t special[] = { 0x00, 0xC0, 0xDB, 0xDC, 0xDD, 0xFF };
+        std::vector<uint8_t> p(length);
+        for (auto &b : p) {
+            rng = rng * 1103515245u + 12345u;
+            uint32_t r = rng >> 16;
+            b = (r % 4 == 0) ? special[(r >> 4) % 6] : (uint8_t)(r >> 8);
+        }
+        return p;
+    }
+
+    void push_raw(const std::vector<uint8_t> &bytes) {
+        for (uint8_t b : bytes) {
+            ASSERT_TRUE(cb_insert(&ring, b));
+        }
+    }
+
+    void round_trip(cb_frame_codec_t codec) {
+        const size_t lengths[] = { 0, 1, 253, 254, 255, 256, 300, 17, 508, 3 };
+        std::vector<uint8_t> out(600);
+        for (int round = 0; round < 20; round++) {
+            for (size_t len : lengths) {
+                if (len == 0 && codec == CB_FRAME_SLIP) {
+                    continue;   // Empty SLIP frames are skipped by design
+                }
+                std::vector<uint8_t> p = payload(len);
+                ASSERT_EQ(cb_frame_encode(&ring, codec, p.data(), p.size()), CB_SUCCESS);
+
+                size_t decoded = 0;
+                ASSERT_EQ(cb_frame_decode(&ring, codec, out.data(), out.size(), &decoded), CB_SUCCESS);
+                ASSERT_EQ(decoded, len);
+                ASSERT_TRUE(std::equal(p.begin(), p.end(), out.begin())) << "len=" << len;
+                ASSERT_EQ(cb_dataSize(&ring), 0u);
+            }
+        }
+    }
+};
+
+// Encoded frames decode back to the payload, across the wrap
+TEST_F(FrameTest, CobsRoundTrip) {
+    round_trip(CB_FRAME_COBS);
+}
+
+TEST_F(FrameTest, SlipRoundTrip) {
+    round_trip(CB_FRAME_SLIP);
+}
+
+// Frames produced by another encoder decode correctly
+TEST_F(FrameTest, KnownVectors) {
+    uint8_t out[16];
+    size_t length;
+
+    push_raw({ 0x03, 0x11, 0x22, 0x02, 0x33, 0x00 });
+    ASSERT_EQ(cb_frame_decode(&ring, CB_FRAME_COBS, out, sizeof(out), &length), CB_SUCCESS);
+    ASSERT_EQ(length, 4u);
+    EXPECT_EQ(out[0], 0x11);
+    EXPECT_EQ(out[1], 0x22);
+    EXPECT_EQ(out[2], 0x00);
+    EXPECT_EQ(out[3], 0x33);
+
+    // Leading END, escaped END and ESC
+    push_raw({ 0xC0, 0x01, 0xDB, 0xDC, 0xDB, 0xDD, 0x02, 0xC0 });
+    ASSERT_EQ(cb_frame_decode(&ring, CB_FRAME_SLIP, out, sizeof(out), &length), CB_SUCCESS);
+    ASSERT_EQ(length, 4u);
+    EXPECT_EQ(out[0], 0x01);
+    EXPECT_EQ(out[1], 0xC0);
+    EXPECT_EQ(out[2], 0xDB);
+    EXPECT_EQ(out[3], 0x02);
+    EXPECT_EQ(cb_dataSize(&ring), 0u);
+}
+
+// Several queued frames come out one at a time; a partial frame waits
+TEST_F(FrameTest, FindAndPartialFrames) {
+    const uint8_t a[] = { 1, 2, 3 };
+    const uint8_t b[] = { 0, 0, 9 };
+    uint8_t out[8];
+    size_t length;
+    CbIndex frame;
+
+    ASSERT_EQ(cb_frame_encode(&ring, CB_FRAME_COBS, a, sizeof(a)), CB_SUCCESS);
+    ASSERT_EQ(cb_frame_encode(&ring, CB_FRAME_COBS, b, sizeof(b)), CB_SUCCESS);
+    push_raw({ 0x02, 0x07 });
+
+    ASSERT_EQ(cb_frame_find(&ring, CB_FRAME_COBS, &frame), CB_SUCCESS);
+    EXPECT_EQ(frame, 5u);
+
+    ASSERT_EQ(cb_frame_decode(&ring, CB_FRAME_COBS, out, sizeof(out), &length), CB_SUCCESS);
+    EXPECT_EQ(length, 3u);
+    ASSERT_EQ(cb_frame_decode(&ring, CB_FRAME_COBS, out, sizeof(out), &length), CB_SUCCESS);
+    EXPECT_EQ(length, 3u);
+    EXPECT_EQ(out[2], 9);
+
+    EXPECT_EQ(cb_frame_decode(&ring, CB_FRAME_COBS, out, sizeof(out), &length), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_frame_find(&ring, CB_FRAME_COBS, &frame), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_dataSize(&ring), 2u);
+
+    push_raw({ 0x00 });
+    ASSERT_EQ(cb_frame_decode(&ring, CB_FRAME_COBS, out, sizeof(out), &length), CB_SUCCESS);
+    EXPECT_EQ(length, 1u);
+    EXPECT_EQ(out[0], 7);
+}
+
+// A short buffer keeps the frame; a malformed frame is dropped
+TEST_F(FrameTest, SizeAndCorruption) {
+    std::vector<uint8_t> p = payload(40);
+    std::vector<uint8_t> out(64);
+    size_t length;
+
+    ASSERT_EQ(cb_frame_encode(&ring, CB_FRAME_SLIP, p.data(), p.size()), CB_SUCCESS);
+    CbIndex stored = cb_dataSize(&ring);
+    EXPECT_EQ(cb_frame_decode(&ring, CB_FRAME_SLIP, out.data(), 39, &length), CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_dataSize(&ring), stored);
+    ASSERT_EQ(cb_frame_decode(&ring, CB_FRAME_SLIP, out.data(), 40, &length), CB_SUCCESS);
+    EXPECT_EQ(length, 40u);
+
+    push_raw({ 0x05, 0x11, 0x00, 0x02, 0x22, 0x00 });
+    EXPECT_EQ(cb_frame_decode(&ring, CB_FRAME_COBS, out.data(), out.size(), &length), CB_ERROR_BUFFER_CORRUPTED);
+    ASSERT_EQ(cb_frame_decode(&ring, CB_FRAME_COBS, out.data(), out.size(), &length), CB_SUCCESS);
+    EXPECT_EQ(length, 1u);
+    EXPECT_EQ(out[0], 0x22);
+
+    push_raw({ 0x01, 0xDB, 0x05, 0xC0 });
+    EXPECT_EQ(cb_frame_decode(&ring, CB_FRAME_SLIP, out.data(), out.size(), &length), CB_ERROR_BUFFER_CORRUPTED);
+    EXPECT_EQ(cb_dataSize(&ring), 0u);
+}
+
+// Encoding is all or nothing
+TEST_F(FrameTest, EncodeFull) {
+    std::vector<uint8_t> p(FRAME_RING, 0xC0);
+    EXPECT_EQ(cb_frame_encode(&ring, CB_FRAME_SLIP, p.data(), 600), CB_ERROR_BUFFER_FULL);
+    EXPECT_EQ(cb_dataSize(&ring), 0u);
+    EXPECT_EQ(cb_frame_encode(&ring, CB_FRAME_COBS, p.data(), FRAME_RING - 2), CB_ERROR_BUFFER_FULL);
+    EXPECT_EQ(cb_dataSize(&ring), 0u);
+    EXPECT_EQ(cb_frame_encode(&ring, CB_FRAME_SLIP, p.data(), 500), CB_SUCCESS);
+    EXPECT_EQ(cb_dataSize(&ring), 1001u);
+    EXPECT_EQ(cb_frame_encode(NULL, CB_FRAME_SLIP, p.data(), 1), CB_ERROR_NULL_POINTER);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,113 @@
+#include "test_common.h"
+#include "cb_iter.h"
+#include <vector>
+
+#define ITER_ELEMENT 16
+#define ITER_RING (ITER_ELEMENT * 32)
+
+// Define IterTest fixture
+class IterTest : public ::testing::Test {
+protected:
+    cb ring;
+    CbItem storage[ITER_RING];
+
+    struct Visit {
+        std::vector<CbItem> first;  // First item of each element seen
+        size_t stop_after;          // Return false at this many visits (0 = never)
+    };
+
+    void SetUp() override {
+        ASSERT_EQ(cb_init_ex(&ring, storage, ITER_RING), CB_SUCCESS);
+    }
+
+    void TearDown() override {
+        // Reset buffer statistics
+        cb_reset_stats(&ring);
+    }
+
+    // Element n is ITER_ELEMENT copies of (CbItem)n
+    void push_elements(int first, int count) {
+        for (int n = first; n < first + count; n++) {
+            for (int i = 0; i < ITER_ELEMENT; i++) {
+                ASSERT_TRUE(cb_insert(&ring, (CbItem)n));
+            }
+        }
+    }
+
+    static bool record(void *element, void *ctx) {
+        Visit *v = (Visit *)ctx;
+        const CbItem *items = (const CbItem *)element;
+        for (int i = 1; i < ITER_ELEMENT; i++) {
+            EXPECT_EQ(items[i], items[0]);
+        }
+        v->first.push_back(items[0]);
+        return v->stop_after == 0 || v->first.size() < v->stop_after;
+    }
+};
+
+// Elements are visited in order across the wrap and released at once
+TEST_F(IterTest, VisitsInOrderAcrossWrap) {
+    const size_t distances[] = { 0, 64, 4096, CB_ITER_NO_PREFETCH };
+    int next_in = 0, next_out = 0;
+
+    for (int round = 0; round < 40; round++) {
+        int n = 5 + round % 17;
+        int free_elements = (int)(cb_freeSpace(&ring) / ITER_ELEMENT);
+        if (n > free_elements) {
+            n = free_elements;
+        }
+        push_elements(next_in, n);
+        next_in += n;
+
+        Visit v = { {}, 0 };
+        CbIndex visited;
+        CbIndex stored = cb_dataSize(&ring) / ITER_ELEMENT;
+        CbIndex max = (CbIndex)(3 + round % 11);
+        ASSERT_EQ(cb_for_each_available(&ring, ITER_ELEMENT, distances[round % 4], record, &v, max, &visited),
+                  CB_SUCCESS);
+        ASSERT_EQ(visited, std::min(stored, max));
+        ASSERT_EQ(v.first.size(), visited);
+        for (CbItem first : v.first) {
+            ASSERT_EQ(first, (CbItem)next_out);
+            next_out++;
+        }
+        ASSERT_EQ(cb_dataSize(&ring), (stored - visited) * ITER_ELEMENT);
+    }
+}
+
+// A handler returning false stops the walk; its element is consumed
+TEST_F(IterTest, EarlyStop) {
+    push_elements(0, 10);
+
+    Visit v = { {}, 4 };
+    CbIndex visited;
+    ASSERT_EQ(cb_for_each_available(&ring, ITER_ELEMENT, 0, record, &v, 100, &visited), CB_SUCCESS);
+    EXPECT_EQ(visited, 4u);
+    EXPECT_EQ(cb_dataSize(&ring), 6u * ITER_ELEMENT);
+
+    CbItem item;
+    ASSERT_TRUE(cb_peek(&ring, 0, &item));
+    EXPECT_EQ(item, 4);
+}
+
+// Partial elements are left alone; bad arguments are rejected
+TEST_F(IterTest, Errors) {
+    Visit v = { {}, 0 };
+    CbIndex visited;
+
+    EXPECT_EQ(cb_for_each_available(&ring, ITER_ELEMENT, 0, record, &v, 1, &visited), CB_ERROR_BUFFER_EMPTY);
+    for (int i = 0; i < ITER_ELEMENT - 1; i++) {
+        cb_insert(&ring, 1);
+    }
+    EXPECT_EQ(cb_for_each_available(&ring, ITER_ELEMENT, 0, record, &v, 1, &visited), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_for_each_available(&ring, 7, 0, record, &v, 1, &visited), CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_for_each_available(&ring, 0, 0, record, &v, 1, &visited), CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_for_each_available(&ring, ITER_ELEMENT, 0, record, &v, 0, &visited), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_for_each_available(&ring, ITER_ELEMENT, 0, NULL, &v, 1, &visited), CB_ERROR_NULL_POINTER);
+    EXPECT_TRUE(v.first.empty());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,115 @@
+#include "test_common.h"
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// A ring longer than 4 Gi items, so 32-bit indices would wrap
+#define LARGE_RING ((uint64_t)5 << 30)
+#define FOUR_GI    ((uint64_t)1 << 32)
+
+// Define LargeTest fixture
+class LargeTest : public ::testing::Test {
+protected:
+    cb ring;
+    int fd = -1;
+    CbItem *storage = NULL;
+    size_t bytes = 0;
+
+    void SetUp() override {
+        if (sizeof(CbIndex) < 8) {
+            GTEST_SKIP() << "CbIndex is narrower than 64 bits";
+        }
+
+        // Sparse file: only the pages the test touches are ever allocated
+        char path[] = "/tmp/cb_large_XXXXXX";
+        fd = mkstemp(path);
+        ASSERT_GE(fd, 0);
+        unlink(path);
+        bytes = (size_t)(LARGE_RING * sizeof(CbItem));
+        ASSERT_EQ(ftruncate(fd, (off_t)bytes), 0);
+
+        void *map = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_NORESERVE, fd, 0);
+        if (map == MAP_FAILED) {
+            GTEST_SKIP() << "cannot map " << bytes << " bytes";
+        }
+        storage = (CbItem *)map;
+        ASSERT_EQ(cb_init_ex(&ring, storage, (CbIndex)LARGE_RING), CB_SUCCESS);
+    }
+
+    void TearDown() override {
+        // Reset buffer statistics and release the mapping
+        if (storage) {
+            cb_reset_stats(&ring);
+            munmap(storage, bytes);
+        }
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+
+    // Move both indices to `pos` without touching the storage
+    void seek(CbIndex pos) {
+        ASSERT_EQ(cb_commit_write_ex(&ring, pos), CB_SUCCESS);
+        ASSERT_EQ(cb_commit_read_ex(&ring, pos), CB_SUCCESS);
+    }
+};
+
+// Items inserted across the 4 Gi index boundary land past it and read back in order
+TEST_F(LargeTest, CrossesFourGi) {
+    seek((CbIndex)(FOUR_GI - 4));
+    for (int i = 0; i < 8; i++) {
+        ASSERT_EQ(cb_insert_ex(&ring, (CbItem)(i + 1)), CB_SUCCESS);
+    }
+    EXPECT_EQ(ring.in, (CbIndex)(FOUR_GI + 4));
+    EXPECT_EQ(storage[FOUR_GI], (CbItem)5);
+    EXPECT_EQ(storage[0], (CbItem)0);
+
+    CbItem item;
+    for (int i = 0; i < 8; i++) {
+        ASSERT_EQ(cb_remove_ex(&ring, &item), CB_SUCCESS);
+        EXPECT_EQ(item, (CbItem)(i + 1));
+    }
+    EXPECT_EQ(cb_dataSize(&ring), 0u);
+}
+
+// More than 4 Gi items can be held and counted at once
+TEST_F(LargeTest, HoldsMoreThanFourGi) {
+    ASSERT_EQ(cb_commit_write_ex(&ring, (CbIndex)(FOUR_GI + 10)), CB_SUCCESS);
+    EXPECT_EQ(cb_dataSize(&ring), (CbIndex)(FOUR_GI + 10));
+    EXPECT_EQ(cb_freeSpace(&ring), (CbIndex)(LARGE_RING - 1 - FOUR_GI - 10));
+
+    cb_span_t spans[2];
+    CbIndex available;
+    ASSERT_EQ(cb_get_read_spans_ex(&ring, spans, &available), CB_SUCCESS);
+    EXPECT_EQ(available, (CbIndex)(FOUR_GI + 10));
+    EXPECT_EQ(spans[0].count, (CbIndex)(FOUR_GI + 10));
+    EXPECT_EQ(cb_commit_read_ex(&ring, (CbIndex)(FOUR_GI + 11)), CB_ERROR_INVALID_COUNT);
+}
+
+// Writes wrap from the end of a multi-GB mapping to its start, and reach the file
+TEST_F(LargeTest, WrapsAndPersists) {
+    seek((CbIndex)(LARGE_RING - 2));
+    CbItem items[4] = { 7, 8, 9, 10 };
+    CbIndex inserted;
+    ASSERT_EQ(cb_insert_bulk_ex(&ring, items, 4, &inserted), CB_SUCCESS);
+    EXPECT_EQ(inserted, 4u);
+    EXPECT_EQ(ring.in, (CbIndex)2);
+
+    CbItem on_disk[2];
+    ASSERT_EQ(pread(fd, on_disk, sizeof(on_disk), (off_t)((LARGE_RING - 2) * sizeof(CbItem))),
+              (ssize_t)sizeof(on_disk));
+    EXPECT_EQ(on_disk[0], (CbItem)7);
+    EXPECT_EQ(on_disk[1], (CbItem)8);
+
+    CbItem out[4];
+    CbIndex removed;
+    ASSERT_EQ(cb_remove_bulk_ex(&ring, out, 4, &removed), CB_SUCCESS);
+    EXPECT_EQ(removed, 4u);
+    EXPECT_EQ(memcmp(out, items, sizeof(items)), 0);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
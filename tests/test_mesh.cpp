@@ -0,0 +1,169 @@
+#include "test_common.h"
+#include "cb_mesh.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#define MESH_PRODUCERS 3
+#define MESH_CONSUMERS 2
+#define MESH_RING 64
+
+// Define MeshTest fixture
+class MeshTest : public ::testing::Test {
+protected:
+    cb_mesh_t mesh;
+    cb rings[MESH_PRODUCERS * MESH_CONSUMERS];
+    CbItem storage[MESH_PRODUCERS * MESH_CONSUMERS * MESH_RING];
+
+    void SetUp() override {
+        ASSERT_EQ(cb_mesh_init(&mesh, MESH_PRODUCERS, MESH_CONSUMERS, rings, storage, MESH_RING), CB_SUCCESS);
+    }
+
+    void TearDown() override {
+        // Reset buffer statistics
+        for (auto &ring : rings) {
+            cb_reset_stats(&ring);
+        }
+    }
+};
+
+// Items reach only their destination and readiness follows the rings
+TEST_F(MeshTest, SendAndReadiness) {
+    EXPECT_EQ(cb_mesh_ready(&mesh, 0), 0u);
+    ASSERT_EQ(cb_mesh_send(&mesh, 2, 1, 42), CB_SUCCESS);
+    EXPECT_EQ(cb_mesh_ready(&mesh, 0), 0u);
+    EXPECT_EQ(cb_mesh_ready(&mesh, 1), 1u << 2);
+    EXPECT_EQ(cb_dataSize(cb_mesh_channel(&mesh, 2, 1)), 1u);
+
+    CbItem item;
+    unsigned from;
+    EXPECT_EQ(cb_mesh_recv_any(&mesh, 0, &item, &from), CB_ERROR_BUFFER_EMPTY);
+    ASSERT_EQ(cb_mesh_recv_any(&mesh, 1, &item, &from), CB_SUCCESS);
+    EXPECT_EQ(item, 42);
+    EXPECT_EQ(from, 2u);
+
+    // The bit is dropped once the ring is seen empty
+    EXPECT_EQ(cb_mesh_recv_any(&mesh, 1, &item, &from), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_mesh_ready(&mesh, 1), 0u);
+}
+
+// Ready producers are served round-robin
+TEST_F(MeshTest, FairRecvAny) {
+    for (unsigned p = 0; p < MESH_PRODUCERS; p++) {
+        for (int i = 0; i < 4; i++) {
+            ASSERT_EQ(cb_mesh_send(&mesh, p, 0, (CbItem)(p * 10 + i)), CB_SUCCESS);
+        }
+    }
+
+    CbItem item;
+    unsigned from;
+    for (int i = 0; i < 4; i++) {
+        for (unsigned p = 0; p < MESH_PRODUCERS; p++) {
+            ASSERT_EQ(cb_mesh_recv_any(&mesh, 0, &item, &from), CB_SUCCESS);
+            EXPECT_EQ(from, p);
+            EXPECT_EQ(item, (CbItem)(p * 10 + i));
+        }
+    }
+    EXPECT_EQ(cb_mesh_recv_any(&mesh, 0, &item, &from), CB_ERROR_BUFFER_EMPTY);
+}
+
+// Bulk transfers wrap, stop at capacity and come from one producer at a time
+TEST_F(MeshTest, Bulk) {
+    CbItem items[100], out[100];
+    for (int i = 0; i < 100; i++) {
+        items[i] = (CbItem)i;
+    }
+
+    CbIndex sent, received;
+    unsigned from;
+    ASSERT_EQ(cb_mesh_send_bulk(&mesh, 1, 0, items, 50, &sent), CB_SUCCESS);
+    ASSERT_EQ(cb_mesh_recv_bulk(&mesh, 0, out, 30, &received, &from), CB_SUCCESS);
+    EXPECT_EQ(received, 30u);
+
+    ASSERT_EQ(cb_mesh_send_bulk(&mesh, 1, 0, items + 50, 50, &sent), CB_SUCCESS);
+    EXPECT_EQ(sent, (CbIndex)(MESH_RING - 1 - 20));
+    ASSERT_EQ(cb_mesh_send_bulk(&mesh, 0, 0, items, 5, &sent), CB_SUCCESS);
+    EXPECT_EQ(cb_mesh_send_bulk(&mesh, 1, 0, items, 5, &sent), CB_ERROR_BUFFER_FULL);
+
+    // Producer 1 was served last, so producer 0 comes next
+    ASSERT_EQ(cb_mesh_recv_bulk(&mesh, 0, out, 100, &received, &from), CB_SUCCESS);
+    EXPECT_EQ(from, 0u);
+    EXPECT_EQ(received, 5u);
+
+    ASSERT_EQ(cb_mesh_recv_bulk(&mesh, 0, out, 100, &received, &from), CB_SUCCESS);
+    EXPECT_EQ(from, 1u);
+    ASSERT_EQ(received, (CbIndex)(MESH_RING - 1));
+    for (CbIndex i = 0; i < received; i++) {
+        EXPECT_EQ(out[i], (CbItem)(30 + i));
+    }
+}
+
+// Concurrent producers and consumers lose nothing and keep per-channel order
+TEST_F(MeshTest, Concurrent) {
+    const int per_channel = 20000;
+    std::vector<std::thread> threads;
+    std::atomic<int> failures{0};
+    std::atomic<long> total{0};
+
+    for (unsigned p = 0; p < MESH_PRODUCERS; p++) {
+        threads.emplace_back([&, p]() {
+            for (int i = 0; i < per_channel; i++) {
+                for (unsigned c = 0; c < MESH_CONSUMERS; c++) {
+                    while (cb_mesh_send(&mesh, p, c, (CbItem)i) != CB_SUCCESS) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        });
+    }
+    for (unsigned c = 0; c < MESH_CONSUMERS; c++) {
+        threads.emplace_back([&, c]() {
+            CbItem expected[MESH_PRODUCERS] = {};
+            int count = 0;
+            CbItem item;
+            unsigned from;
+            while (count < MESH_PRODUCERS * per_channel) {
+                if (cb_mesh_recv_any(&mesh, c, &item, &from) != CB_SUCCESS) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                if (item != expected[from]) {
+                    failures++;
+                }
+                expected[from] = (CbItem)(item + 1);
+                count++;
+            }
+            total += count;
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(failures.load(), 0);
+    EXPECT_EQ(total.load(), (long)MESH_PRODUCERS * MESH_CONSUMERS * per_channel);
+}
+
+// Invalid arguments are rejected
+TEST_F(MeshTest, Errors) {
+    cb_mesh_t other;
+    CbItem item;
+    unsigned from;
+    CbIndex n;
+
+    EXPECT_EQ(cb_mesh_init(&other, 0, 1, rings, storage, MESH_RING), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_mesh_init(&other, CB_MESH_MAX_PRODUCERS + 1, 1, rings, storage, MESH_RING),
+              CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_mesh_init(&other, 1, 1, rings, storage, 0), CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_mesh_send(&mesh, MESH_PRODUCERS, 0, 1), CB_ERROR_INVALID_PARAMETER);
+    EXPECT_EQ(cb_mesh_send(&mesh, 0, MESH_CONSUMERS, 1), CB_ERROR_INVALID_PARAMETER);
+    EXPECT_EQ(cb_mesh_send_bulk(&mesh, 0, 0, &item, 0, &n), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_mesh_recv_any(&mesh, MESH_CONSUMERS, &item, &from), CB_ERROR_INVALID_PARAMETER);
+    EXPECT_EQ(cb_mesh_recv_bulk(&mesh, 0, &item, 0, &n, &from), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_mesh_channel(&mesh, MESH_PRODUCERS, 0), nullptr);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
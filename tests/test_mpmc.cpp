@@ -0,0 +1,235 @@
+#include "test_common.h"
+#include "cb_mpmc.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#define MPMC_RING 64
+
+// Define MpmcTest fixture
+class MpmcTest : public ::testing::Test {
+protected:
+    cb_mpmc_t q;
+    CbItem storage[MPMC_RING];
+    CbItem wide[16 * MPMC_RING];     // Large enough to span several lines
+
+    void SetUp() override {
+        ASSERT_EQ(cb_mpmc_init(&q, storage, MPMC_RING, 0), CB_SUCCESS);
+    }
+
+    // Run producers and consumers concurrently and check that nothing is lost
+    void runConcurrent() {
+        const int threads = 4;
+        const int per_thread = 20000;
+        std::atomic<int> consumed{0};
+        std::atomic<unsigned long> sum{0};
+        std::vector<std::thread> workers;
+
+        for (int t = 0; t < threads; t++) {
+            workers.emplace_back([&, t]() {
+                CbItem burst[32];
+                for (int i = 0; i < 32; i++) {
+                    burst[i] = (CbItem)(i + 1);
+                }
+                for (int sent = 0; sent < per_thread;) {
+                    // A partial burst resumes where it stopped
+                    uint32_t offset = (uint32_t)(sent % 32);
+                    uint32_t n = 32 - offset;
+                    cb_result_t result = (t & 1) ? cb_mpmc_enqueue_bulk(&q, burst + offset, n)
+                                                 : cb_mpmc_enqueue_burst(&q, burst + offset, n, &n);
+                    if (result == CB_SUCCESS) {
+                        sent += (int)n;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+            workers.emplace_back([&]() {
+                CbItem burst[32];
+                uint32_t n;
+                while (consumed.load() < threads * per_thread) {
+                    if (cb_mpmc_dequeue_burst(&q, burst, 32, &n) == CB_SUCCESS) {
+                        unsigned long local = 0;
+                        for (uint32_t i = 0; i < n; i++) {
+                            local += burst[i];
+                        }
+                        sum += local;
+                        consumed += (int)n;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (auto &worker : workers) {
+            worker.join();
+        }
+
+        // Every producer sends the values 1..32 625 times over
+        EXPECT_EQ(consumed.load(), threads * per_thread);
+        EXPECT_EQ(sum.load(), (unsigned long)threads * (per_thread / 32) * (32 * 33 / 2));
+        EXPECT_EQ(cb_mpmc_count(&q), 0u);
+    }
+};
+
+// Bulk calls move all items or none
+TEST_F(MpmcTest, BulkAllOrNothing) {
+    CbItem in[MPMC_RING];
+    CbItem out[MPMC_RING];
+    for (int i = 0; i < MPMC_RING; i++) {
+        in[i] = (CbItem)i;
+    }
+
+    ASSERT_EQ(cb_mpmc_enqueue_bulk(&q, in, 40), CB_SUCCESS);
+    EXPECT_EQ(cb_mpmc_enqueue_bulk(&q, in, 32), CB_ERROR_BUFFER_FULL);
+    EXPECT_EQ(cb_mpmc_count(&q), 40u);
+    ASSERT_EQ(cb_mpmc_enqueue_bulk(&q, in + 40, 24), CB_SUCCESS);
+    EXPECT_EQ(cb_mpmc_count(&q), (uint32_t)MPMC_RING);
+
+    EXPECT_EQ(cb_mpmc_dequeue_bulk(&q, out, MPMC_RING + 1), CB_ERROR_BUFFER_EMPTY);
+    ASSERT_EQ(cb_mpmc_dequeue_bulk(&q, out, MPMC_RING), CB_SUCCESS);
+    EXPECT_EQ(memcmp(in, out, sizeof(in)), 0);
+    EXPECT_EQ(cb_mpmc_dequeue_bulk(&q, out, 1), CB_ERROR_BUFFER_EMPTY);
+}
+
+// Burst calls move what fits and report the count
+TEST_F(MpmcTest, BurstPartial) {
+    CbItem in[48];
+    CbItem out[48];
+    uint32_t n;
+    for (int i = 0; i < 48; i++) {
+        in[i] = (CbItem)(i + 1);
+    }
+
+    ASSERT_EQ(cb_mpmc_enqueue_burst(&q, in, 48, &n), CB_SUCCESS);
+    EXPECT_EQ(n, 48u);
+    ASSERT_EQ(cb_mpmc_enqueue_burst(&q, in, 48, &n), CB_SUCCESS);
+    EXPECT_EQ(n, 16u);
+    EXPECT_EQ(cb_mpmc_enqueue_burst(&q, in, 1, &n), CB_ERROR_BUFFER_FULL);
+    EXPECT_EQ(n, 0u);
+
+    ASSERT_EQ(cb_mpmc_dequeue_burst(&q, out, 48, &n), CB_SUCCESS);
+    EXPECT_EQ(n, 48u);
+    EXPECT_EQ(memcmp(in, out, sizeof(in)), 0);
+    ASSERT_EQ(cb_mpmc_dequeue_burst(&q, out, 48, &n), CB_SUCCESS);
+    EXPECT_EQ(n, 16u);
+    EXPECT_EQ(memcmp(in, out, 16), 0);
+    EXPECT_EQ(cb_mpmc_dequeue_burst(&q, out, 48, &n), CB_ERROR_BUFFER_EMPTY);
+}
+
+// Bursts that straddle the end of storage keep their order
+TEST_F(MpmcTest, WrapAround) {
+    CbItem in[32];
+    CbItem out[32];
+    for (int round = 0; round < 20; round++) {
+        for (int i = 0; i < 32; i++) {
+            in[i] = (CbItem)(round * 32 + i);
+        }
+        ASSERT_EQ(cb_mpmc_enqueue_bulk(&q, in, 21), CB_SUCCESS);
+        ASSERT_EQ(cb_mpmc_dequeue_bulk(&q, out, 21), CB_SUCCESS);
+        ASSERT_EQ(memcmp(in, out, 21), 0) << "round " << round;
+    }
+    EXPECT_EQ(cb_mpmc_count(&q), 0u);
+}
+
+// Concurrent producers and consumers lose and duplicate nothing
+TEST_F(MpmcTest, ConcurrentBursts) {
+    runConcurrent();
+}
+
+// The same with interleaved slots
+TEST_F(MpmcTest, ConcurrentBurstsInterleaved) {
+    ASSERT_EQ(cb_mpmc_init(&q, wide, 16 * MPMC_RING, CB_MPMC_INTERLEAVE), CB_SUCCESS);
+    ASSERT_NE(q.rotate, 0u);
+    runConcurrent();
+}
+
+// Interleaving places consecutive positions a cache line apart, in order
+TEST_F(MpmcTest, InterleavedLayout) {
+    CbItem in[MPMC_RING];
+    CbItem out[MPMC_RING];
+    uint32_t n;
+    for (int i = 0; i < MPMC_RING; i++) {
+        in[i] = (CbItem)(i + 1);
+    }
+
+    ASSERT_EQ(cb_mpmc_init(&q, wide, 16 * MPMC_RING, CB_MPMC_INTERLEAVE), CB_SUCCESS);
+    const uint32_t stride = (sizeof(CbItem) >= CB_MPMC_LINE_SIZE) ? 1 : CB_MPMC_LINE_SIZE / sizeof(CbItem);
+    ASSERT_EQ(cb_mpmc_enqueue_bulk(&q, in, 3), CB_SUCCESS);
+    EXPECT_EQ(wide[0], in[0]);
+    EXPECT_EQ(wide[stride], in[1]);
+    EXPECT_EQ(wide[2 * stride], in[2]);
+
+    // Wrapping bursts come back in order
+    for (int round = 0; round < 40; round++) {
+        ASSERT_EQ(cb_mpmc_enqueue_burst(&q, in, 50, &n), CB_SUCCESS);
+        ASSERT_EQ(n, 50u);
+        ASSERT_EQ(cb_mpmc_dequeue_bulk(&q, out, 50 + (round == 0 ? 3 : 0)), CB_SUCCESS);
+        ASSERT_EQ(memcmp(out + (round == 0 ? 3 : 0), in, 50), 0) << "round " << round;
+    }
+
+    // A ring that fits in one line is not remapped
+    ASSERT_EQ(cb_mpmc_init(&q, storage, 2, CB_MPMC_INTERLEAVE), CB_SUCCESS);
+    EXPECT_EQ(q.rotate, 0u);
+}
+
+// Bursts become visible while producers keep reserving, long before the ring fills
+TEST_F(MpmcTest, VisibleBeforeFull) {
+    static CbItem slots[1 << 16];
+    const uint32_t wanted = 4096;
+    std::atomic<bool> stop{false};
+    std::atomic<int> full{0};
+    std::vector<std::thread> producers;
+
+    ASSERT_EQ(cb_mpmc_init(&q, slots, 1 << 16, 0), CB_SUCCESS);
+    for (int t = 0; t < 2; t++) {
+        producers.emplace_back([this, &stop, &full]() {
+            CbItem burst[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+            while (!stop.load()) {
+                if (cb_mpmc_enqueue_bulk(&q, burst, 8) != CB_SUCCESS) {
+                    full++;
+                }
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    CbItem out[32];
+    uint32_t received = 0;
+    while (received < wanted) {
+        uint32_t n;
+        if (cb_mpmc_dequeue_burst(&q, out, 32, &n) == CB_SUCCESS) {
+            received += n;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    stop.store(true);
+    for (auto &producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_EQ(full.load(), 0);
+    EXPECT_LT(cb_mpmc_count(&q), (uint32_t)(1 << 16));
+}
+
+// Invalid arguments are rejected
+TEST_F(MpmcTest, Errors) {
+    cb_mpmc_t other;
+    CbItem item = 0;
+    uint32_t n;
+
+    EXPECT_EQ(cb_mpmc_init(NULL, storage, 8, 0), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_mpmc_init(&other, storage, 0, 0), CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_mpmc_init(&other, storage, 48, CB_MPMC_INTERLEAVE), CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_mpmc_enqueue_bulk(&q, &item, 0), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_mpmc_enqueue_burst(&q, NULL, 1, &n), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_mpmc_dequeue_burst(&q, &item, 0, &n), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_mpmc_dequeue_bulk(NULL, &item, 1), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_mpmc_count(NULL), 0u);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,170 @@
+#include "test_common.h"
+#include "cb_pack.h"
+#include <thread>
+#include <vector>
+
+#define PACK_STORAGE_BYTES 1536
+
+// Define PackTest fixture
+class PackTest : public ::testing::Test {
+protected:
+    cb_pack_t p;
+    uint8_t storage[PACK_STORAGE_BYTES];
+
+    void SetUp() override {
+        memset(storage, 0, sizeof(storage));
+    }
+
+    void TearDown() override {
+        // Reset buffer statistics
+        cb_reset_stats(&p.ring);
+    }
+
+    static uint32_t pattern(uint32_t i, unsigned bits) {
+        uint32_t v = i * 2654435761u;
+        return (bits == 32) ? v : (v & ((1u << bits) - 1u));
+    }
+};
+
+// Storage scales with the sample width
+TEST_F(PackTest, CapacityFollowsWidth) {
+    ASSERT_EQ(cb_pack_init(&p, storage, sizeof(storage), 12), CB_SUCCESS);
+    EXPECT_EQ(cb_pack_capacity(&p), (CbIndex)(PACK_STORAGE_BYTES * 8 / 12 - 1));
+
+    ASSERT_EQ(cb_pack_init(&p, storage, sizeof(storage), 1), CB_SUCCESS);
+    EXPECT_EQ(cb_pack_capacity(&p), (CbIndex)(PACK_STORAGE_BYTES * 8 - 1));
+
+    ASSERT_EQ(cb_pack_init(&p, storage, sizeof(storage), 32), CB_SUCCESS);
+    EXPECT_EQ(cb_pack_capacity(&p), (CbIndex)(PACK_STORAGE_BYTES / 4 - 1));
+}
+
+// Every width round-trips through unaligned bulk operations that wrap
+TEST_F(PackTest, AllWidthsWrapAround) {
+    for (unsigned bits = 1; bits <= 32; bits++) {
+        ASSERT_EQ(cb_pack_init(&p, storage, sizeof(storage), bits), CB_SUCCESS);
+        CbIndex capacity = cb_pack_capacity(&p);
+        CbIndex chunk = capacity / 3 + 5;
+        std::vector<uint32_t> in(chunk), out(chunk);
+        uint32_t next_in = 0;
+        uint32_t next_out = 0;
+
+        for (int round = 0; round < 10; round++) {
+            CbIndex inserted = 0;
+            for (CbIndex i = 0; i < chunk; i++) {
+                in[i] = pattern(next_in + i, bits) | ~((bits == 32) ? 0xFFFFFFFFu : ((1u << bits) - 1u));
+            }
+            ASSERT_EQ(cb_pack_insert_bulk(&p, in.data(), chunk, &inserted), CB_SUCCESS);
+            ASSERT_EQ(inserted, chunk);
+            next_in += inserted;
+
+            CbIndex removed = 0;
+            CbIndex want = chunk - (CbIndex)(round % 3);
+            ASSERT_EQ(cb_pack_remove_bulk(&p, out.data(), want, &removed), CB_SUCCESS);
+            ASSERT_EQ(removed, want);
+            for (CbIndex i = 0; i < removed; i++) {
+                ASSERT_EQ(out[i], pattern(next_out + i, bits)) << "bits=" << bits << " i=" << i;
+            }
+            next_out += removed;
+        }
+        EXPECT_EQ(cb_pack_count(&p), (CbIndex)(next_in - next_out));
+    }
+}
+
+// 12-bit ADC samples: bulk and single operations see the same stream
+TEST_F(PackTest, TwelveBitMixedOperations) {
+    ASSERT_EQ(cb_pack_init(&p, storage, sizeof(storage), 12), CB_SUCCESS);
+
+    std::vector<uint32_t> in(1000), out(1000);
+    for (size_t i = 0; i < in.size(); i++) {
+        in[i] = (uint32_t)((i * 37) & 0xFFF);
+    }
+
+    CbIndex inserted = 0;
+    ASSERT_EQ(cb_pack_insert(&p, 0xABC), CB_SUCCESS);
+    ASSERT_EQ(cb_pack_insert_bulk(&p, in.data(), (CbIndex)in.size(), &inserted), CB_SUCCESS);
+    EXPECT_EQ(inserted, (CbIndex)in.size());
+
+    uint32_t sample;
+    ASSERT_EQ(cb_pack_remove(&p, &sample), CB_SUCCESS);
+    EXPECT_EQ(sample, 0xABCu);
+
+    CbIndex removed = 0;
+    ASSERT_EQ(cb_pack_remove_bulk(&p, out.data(), (CbIndex)out.size(), &removed), CB_SUCCESS);
+    ASSERT_EQ(removed, (CbIndex)out.size());
+    EXPECT_EQ(out, in);
+}
+
+// Full and empty rings report partial progress like the core bulk calls
+TEST_F(PackTest, FullAndEmpty) {
+    ASSERT_EQ(cb_pack_init(&p, storage, 12, 12), CB_SUCCESS);
+    EXPECT_EQ(cb_pack_capacity(&p), 7);
+
+    uint32_t in[10] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    uint32_t out[10];
+    CbIndex n = 0;
+
+    ASSERT_EQ(cb_pack_insert_bulk(&p, in, 10, &n), CB_SUCCESS);
+    EXPECT_EQ(n, 7);
+    EXPECT_EQ(cb_pack_insert_bulk(&p, in, 10, &n), CB_ERROR_BUFFER_FULL);
+    EXPECT_EQ(n, 0);
+
+    ASSERT_EQ(cb_pack_remove_bulk(&p, out, 10, &n), CB_SUCCESS);
+    EXPECT_EQ(n, 7);
+    EXPECT_EQ(out[6], 7u);
+    EXPECT_EQ(cb_pack_remove_bulk(&p, out, 10, &n), CB_ERROR_BUFFER_EMPTY);
+}
+
+// Invalid arguments are rejected
+TEST_F(PackTest, Errors) {
+    CbIndex n;
+    uint32_t sample = 0;
+
+    EXPECT_EQ(cb_pack_init(NULL, storage, sizeof(storage), 12), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_pack_init(&p, NULL, sizeof(storage), 12), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_pack_init(&p, storage, sizeof(storage), 0), CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_pack_init(&p, storage, sizeof(storage), 33), CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_pack_init(&p, storage, 2, 12), CB_ERROR_INVALID_SIZE);
+
+    ASSERT_EQ(cb_pack_init(&p, storage, sizeof(storage), 12), CB_SUCCESS);
+    EXPECT_EQ(cb_pack_insert_bulk(&p, &sample, 0, &n), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_pack_insert_bulk(&p, NULL, 1, &n), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_pack_remove_bulk(&p, &sample, 1, NULL), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_pack_count(NULL), 0);
+    EXPECT_EQ(cb_pack_capacity(NULL), 0);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+// Producer and consumer write and read neighbouring samples in shared bytes
+TEST_F(PackTest, ConcurrentSharedBytes) {
+    const uint32_t total = 50000;
+    ASSERT_EQ(cb_pack_init(&p, storage, 16, 5), CB_SUCCESS);
+
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < total;) {
+            if (cb_pack_insert(&p, pattern(i, 5)) == CB_SUCCESS) {
+                i++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint32_t mismatches = 0;
+    for (uint32_t i = 0; i < total;) {
+        uint32_t v;
+        if (cb_pack_remove(&p, &v) == CB_SUCCESS) {
+            mismatches += (v != pattern(i, 5));
+            i++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    EXPECT_EQ(mismatches, 0u);
+    EXPECT_EQ(cb_pack_count(&p), 0u);
+}
@@ -0,0 +1,148 @@
+#include "test_common.h"
+#include "cb_pcpu.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#define PCPU_CPUS 64
+#define PCPU_RING 256
+
+// Define PcpuTest fixture
+class PcpuTest : public ::testing::Test {
+protected:
+    cb_pcpu_t pc;
+    cb_pcpu_ring_t rings[PCPU_CPUS];
+    CbItem storage[PCPU_CPUS * PCPU_RING];
+
+    struct Tally {
+        std::mutex lock;
+        std::vector<uint64_t> counts = std::vector<uint64_t>(256, 0);
+        uint64_t total = 0;
+    };
+
+    void TearDown() override {
+        // Stop the collector and reset buffer statistics
+        cb_pcpu_stop(&pc);
+        for (auto &r : rings) {
+            cb_reset_stats(&r.ring);
+        }
+    }
+
+    static void tally(const CbItem *items, size_t count, void *ctx) {
+        Tally *t = (Tally *)ctx;
+        std::lock_guard<std::mutex> guard(t->lock);
+        for (size_t i = 0; i < count; i++) {
+            t->counts[items[i]]++;
+        }
+        t->total += count;
+    }
+
+    // Every thread emits `per_thread` items of value (thread index)
+    void emit_concurrently(unsigned threads, unsigned per_thread, Tally *t) {
+        ASSERT_EQ(cb_pcpu_start(&pc, tally, t, 50), CB_SUCCESS);
+
+        std::vector<std::thread> workers;
+        std::atomic<int> errors{0};
+        for (unsigned n = 0; n < threads; n++) {
+            workers.emplace_back([&, n]() {
+                for (unsigned i = 0; i < per_thread;) {
+                    cb_result_t result = cb_pcpu_insert(&pc, (CbItem)n);
+                    if (result == CB_SUCCESS) {
+                        i++;
+                    } else if (result == CB_ERROR_BUFFER_FULL) {
+                        std::this_thread::yield();
+                    } else {
+                        errors++;
+                        return;
+                    }
+                }
+            });
+        }
+        for (auto &w : workers) {
+            w.join();
+        }
+        ASSERT_EQ(cb_pcpu_stop(&pc), CB_SUCCESS);
+        EXPECT_EQ(errors.load(), 0);
+    }
+};
+
+// Items inserted by one thread are collected in order
+TEST_F(PcpuTest, InsertAndCollect) {
+    ASSERT_EQ(cb_pcpu_init(&pc, rings, PCPU_CPUS, storage, PCPU_RING, 0), CB_SUCCESS);
+
+    for (int i = 0; i < 10; i++) {
+        ASSERT_EQ(cb_pcpu_insert(&pc, (CbItem)i), CB_SUCCESS);
+    }
+
+    CbItem items[32];
+    size_t n;
+    ASSERT_EQ(cb_pcpu_collect(&pc, items, 32, &n), CB_SUCCESS);
+    // The thread may have migrated between CPUs; each ring keeps its own order
+    EXPECT_EQ(n, 10u);
+    EXPECT_EQ(cb_pcpu_collect(&pc, items, 32, &n), CB_ERROR_BUFFER_EMPTY);
+}
+
+// A full CPU ring reports BUFFER_FULL instead of overwriting
+TEST_F(PcpuTest, FullRing) {
+    ASSERT_EQ(cb_pcpu_init(&pc, rings, PCPU_CPUS, storage, PCPU_RING, 0), CB_SUCCESS);
+
+    // Pin to one CPU so all items land in one ring
+    cpu_set_t saved, set;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(saved), &saved), 0);
+    CPU_ZERO(&set);
+    CPU_SET(0, &set);
+    ASSERT_EQ(sched_setaffinity(0, sizeof(set), &set), 0);
+
+    int inserted = 0;
+    while (cb_pcpu_insert(&pc, 1) == CB_SUCCESS) {
+        inserted++;
+    }
+    sched_setaffinity(0, sizeof(saved), &saved);
+    EXPECT_EQ(inserted, PCPU_RING - 1);
+    EXPECT_EQ(cb_dataSize(&rings[0].ring), (CbIndex)(PCPU_RING - 1));
+}
+
+// Many threads emit through rseq (when available); nothing is lost
+TEST_F(PcpuTest, ConcurrentRseq) {
+    ASSERT_EQ(cb_pcpu_init(&pc, rings, PCPU_CPUS, storage, PCPU_RING, 0), CB_SUCCESS);
+    RecordProperty("rseq", pc.use_rseq ? 1 : 0);
+
+    Tally t;
+    emit_concurrently(8, 20000, &t);
+    EXPECT_EQ(t.total, 8u * 20000u);
+    for (unsigned n = 0; n < 8; n++) {
+        EXPECT_EQ(t.counts[n], 20000u);
+    }
+}
+
+// The locked cb path gives the same result
+TEST_F(PcpuTest, ConcurrentFallback) {
+    ASSERT_EQ(cb_pcpu_init(&pc, rings, 2, storage, PCPU_RING, CB_PCPU_FALLBACK), CB_SUCCESS);
+    EXPECT_FALSE(pc.use_rseq);
+
+    Tally t;
+    emit_concurrently(8, 20000, &t);
+    EXPECT_EQ(t.total, 8u * 20000u);
+    for (unsigned n = 0; n < 8; n++) {
+        EXPECT_EQ(t.counts[n], 20000u);
+    }
+}
+
+// Invalid arguments are rejected
+TEST_F(PcpuTest, Errors) {
+    CbItem items[4];
+    size_t n;
+
+    EXPECT_EQ(cb_pcpu_init(&pc, rings, 0, storage, PCPU_RING, 0), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_pcpu_init(&pc, rings, 1, storage, 0, 0), CB_ERROR_INVALID_SIZE);
+    ASSERT_EQ(cb_pcpu_init(&pc, rings, PCPU_CPUS, storage, PCPU_RING, 0), CB_SUCCESS);
+    EXPECT_EQ(cb_pcpu_collect(&pc, items, 0, &n), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_pcpu_insert(NULL, 1), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_pcpu_start(&pc, NULL, NULL, 0), CB_ERROR_NULL_POINTER);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,165 @@
+#include "test_common.h"
+#include "cb_quant.h"
+#include <algorithm>
+#include <vector>
+
+#define QUANT_RING 512
+#define QUANT_BUCKETS 64
+
+// Define QuantTest fixture
+class QuantTest : public ::testing::Test {
+protected:
+    cb ring;
+    cb_quant_t q;
+    cb_quant_sketch_t sketch;
+    CbItem storage[QUANT_RING];
+    cb_quant_node_t nodes[QUANT_RING];
+    uint32_t counts[QUANT_BUCKETS];
+    uint32_t rng = 777;
+
+    void SetUp() override {
+        ASSERT_EQ(cb_init_ex(&ring, storage, QUANT_RING), CB_SUCCESS);
+        ASSERT_EQ(cb_quant_sketch_init(&sketch, counts, QUANT_BUCKETS, 0.0, 256.0), CB_SUCCESS);
+        ASSERT_EQ(cb_quant_init(&q, &ring, nodes, QUANT_RING, &sketch), CB_SUCCESS);
+    }
+
+    void TearDown() override {
+        // Reset buffer statistics
+        cb_reset_stats(&ring);
+    }
+
+    CbItem next_item() {
+        rng = rng * 1103515245u + 12345u;
+        return (CbItem)((rng >> 16) % 200);
+    }
+
+    // Sorted copy of the ring contents
+    std::vector<CbItem> sorted_contents() {
+        std::vector<CbItem> v(cb_dataSize(&ring));
+        for (size_t i = 0; i < v.size(); i++) {
+            cb_peek_ex(&ring, (CbIndex)i, &v[i]);
+        }
+        std::sort(v.begin(), v.end());
+        return v;
+    }
+
+    void check_exact() {
+        std::vector<CbItem> v = sorted_contents();
+        CbItem item;
+        if (v.empty()) {
+            ASSERT_EQ(cb_quant_median(&q, &item), CB_ERROR_BUFFER_EMPTY);
+            return;
+        }
+        for (size_t k = 0; k < v.size(); k += 1 + v.size() / 17) {
+            ASSERT_EQ(cb_quant_rank(&q, (CbIndex)k, &item), CB_SUCCESS);
+            ASSERT_EQ(item, v[k]) << "k=" << k;
+        }
+        ASSERT_EQ(cb_quant_median(&q, &item), CB_SUCCESS);
+        ASSERT_EQ(item, v[(v.size() - 1) / 2]);
+        ASSERT_EQ(cb_quant_quantile(&q, 0.95, &item), CB_SUCCESS);
+        size_t rank = (size_t)(0.95 * v.size());
+        if ((double)rank < 0.95 * v.size()) rank++;
+        ASSERT_EQ(item, v[std::max<size_t>(rank, 1) - 1]);
+    }
+};
+
+// Exact statistics follow inserts and removals
+TEST_F(QuantTest, ExactUnderInsertRemove) {
+    CbItem item;
+    for (int step = 0; step < 3000; step++) {
+        if (step % 3 == 2 || cb_freeSpace(&ring) == 0) {
+            ASSERT_EQ(cb_quant_remove(&q, &item), CB_SUCCESS);
+        } else {
+            ASSERT_EQ(cb_quant_insert(&q, next_item()), CB_SUCCESS);
+        }
+        if (step % 97 == 0) {
+            check_exact();
+        }
+    }
+    check_exact();
+
+    while (cb_quant_remove(&q, &item) == CB_SUCCESS) {
+    }
+    check_exact();
+}
+
+// Overwrite eviction removes the evicted item from the statistics
+TEST_F(QuantTest, ExactUnderOverwrite) {
+    cb_set_overwrite(&ring, true);
+
+    for (int i = 0; i < 5000; i++) {
+        ASSERT_EQ(cb_quant_insert(&q, next_item()), CB_SUCCESS);
+        if (i % 501 == 0) {
+            check_exact();
+        }
+    }
+    check_exact();
+    EXPECT_EQ(q.size, (uint32_t)(QUANT_RING - 1));
+}
+
+// The sketch stays within one bucket of the exact quantile
+TEST_F(QuantTest, SketchApproximation) {
+    cb_set_overwrite(&ring, true);
+    for (int i = 0; i < 3000; i++) {
+        ASSERT_EQ(cb_quant_insert(&q, next_item()), CB_SUCCESS);
+    }
+
+    const double width = 256.0 / QUANT_BUCKETS;
+    const double ps[] = { 0.0, 0.1, 0.5, 0.95, 0.99, 1.0 };
+    for (double p : ps) {
+        CbItem exact;
+        double approx;
+        ASSERT_EQ(cb_quant_quantile(&q, p, &exact), CB_SUCCESS);
+        ASSERT_EQ(cb_quant_approx(&q, p, &approx), CB_SUCCESS);
+        EXPECT_NEAR(approx, (double)exact, width) << "p=" << p;
+    }
+    EXPECT_EQ(sketch.total, q.size);
+}
+
+// Items already in the ring are picked up at init
+TEST_F(QuantTest, AttachToFilledRing) {
+    cb other;
+    CbItem other_storage[16];
+    cb_quant_node_t other_nodes[16];
+    cb_quant_t q2;
+
+    ASSERT_EQ(cb_init_ex(&other, other_storage, 16), CB_SUCCESS);
+    const CbItem items[] = { 9, 3, 7, 1, 5 };
+    for (CbItem item : items) {
+        cb_insert(&other, item);
+    }
+    ASSERT_EQ(cb_quant_init(&q2, &other, other_nodes, 16, NULL), CB_SUCCESS);
+
+    CbItem median;
+    double approx;
+    ASSERT_EQ(cb_quant_median(&q2, &median), CB_SUCCESS);
+    EXPECT_EQ(median, 5);
+    EXPECT_EQ(cb_quant_approx(&q2, 0.5, &approx), CB_ERROR_INVALID_PARAMETER);
+    cb_reset_stats(&other);
+}
+
+// Invalid arguments are rejected
+TEST_F(QuantTest, Errors) {
+    CbItem item;
+    double value;
+    cb_quant_t other;
+
+    EXPECT_EQ(cb_quant_init(&other, &ring, nodes, QUANT_RING - 1, NULL), CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_quant_init(NULL, &ring, nodes, QUANT_RING, NULL), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_quant_sketch_init(&sketch, counts, 0, 0.0, 1.0), CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_quant_sketch_init(&sketch, counts, 4, 1.0, 1.0), CB_ERROR_INVALID_SIZE);
+
+    EXPECT_EQ(cb_quant_median(&q, &item), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_quant_approx(&q, 0.5, &value), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_quant_remove(&q, &item), CB_ERROR_BUFFER_EMPTY);
+
+    ASSERT_EQ(cb_quant_insert(&q, 4), CB_SUCCESS);
+    EXPECT_EQ(cb_quant_rank(&q, 1, &item), CB_ERROR_INVALID_OFFSET);
+    EXPECT_EQ(cb_quant_quantile(&q, 1.5, &item), CB_ERROR_INVALID_PARAMETER);
+    EXPECT_EQ(cb_quant_approx(&q, -0.1, &value), CB_ERROR_INVALID_PARAMETER);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,124 @@
+#include "test_common.h"
+#include "cb_record.h"
+#include <string.h>
+#include <vector>
+
+// Define RecordTest fixture
+class RecordTest : public ::testing::Test {
+protected:
+    cb buffer;
+    CbItem storage[TEST_BUFFER_SIZE_LARGE];
+    
+    void SetUp() override {
+        cb_init(&buffer, storage, TEST_BUFFER_SIZE_LARGE);
+    }
+    
+    void TearDown() override {
+        // Reset buffer statistics
+        cb_reset_stats(&buffer);
+    }
+};
+
+// Records round-trip with their exact lengths
+TEST_F(RecordTest, WriteRead) {
+    const char *messages[] = {"a", "hello", "", "ring buffer record"};
+    for (const char *m : messages) {
+        EXPECT_EQ(cb_record_write(&buffer, m, strlen(m)), CB_SUCCESS);
+    }
+    
+    char out[64];
+    size_t length = 0;
+    for (const char *m : messages) {
+        EXPECT_EQ(cb_record_peek_length(&buffer, &length), CB_SUCCESS);
+        EXPECT_EQ(length, strlen(m));
+        EXPECT_EQ(cb_record_read(&buffer, out, sizeof(out), &length), CB_SUCCESS);
+        ASSERT_EQ(length, strlen(m));
+        EXPECT_EQ(memcmp(out, m, length), 0);
+    }
+    
+    EXPECT_EQ(cb_record_read(&buffer, out, sizeof(out), &length), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_dataSize(&buffer), 0);
+}
+
+// Records are all-or-nothing and survive wrapping
+TEST_F(RecordTest, WrapAndFull) {
+    std::vector<uint8_t> payload(40);
+    std::vector<uint8_t> out(64);
+    size_t length = 0;
+    
+    for (int round = 0; round < 20; round++) {
+        for (size_t i = 0; i < payload.size(); i++) {
+            payload[i] = (uint8_t)(round * 7 + i);
+        }
+        ASSERT_EQ(cb_record_write(&buffer, payload.data(), payload.size()), CB_SUCCESS);
+        ASSERT_EQ(cb_record_read(&buffer, out.data(), out.size(), &length), CB_SUCCESS);
+        ASSERT_EQ(length, payload.size());
+        EXPECT_EQ(memcmp(out.data(), payload.data(), length), 0);
+    }
+    
+    // Fill until a whole record no longer fits
+    int written = 0;
+    while (cb_record_write(&buffer, payload.data(), payload.size()) == CB_SUCCESS) {
+        written++;
+    }
+    EXPECT_EQ(written, (int)((TEST_BUFFER_SIZE_LARGE - 1) / cb_record_items(payload.size())));
+    EXPECT_EQ(cb_record_write(&buffer, payload.data(), payload.size()), CB_ERROR_BUFFER_FULL);
+}
+
+// A too small destination leaves the record in place
+TEST_F(RecordTest, ReadCapacity) {
+    ASSERT_EQ(cb_record_write(&buffer, "0123456789", 10), CB_SUCCESS);
+    
+    char out[16];
+    size_t length = 0;
+    EXPECT_EQ(cb_record_read(&buffer, out, 4, &length), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(length, 10u);
+    EXPECT_EQ(cb_record_read(&buffer, out, sizeof(out), &length), CB_SUCCESS);
+    EXPECT_EQ(memcmp(out, "0123456789", 10), 0);
+}
+
+// Prepared slots shrink to the actual length; the tail is skipped as filler
+TEST_F(RecordTest, PrepareFinishFiller) {
+    cb_record_view_t view;
+    ASSERT_EQ(cb_record_prepare(&buffer, 0, 32, &view), CB_SUCCESS);
+    memcpy(view.data[0], "abc", 3);
+    EXPECT_EQ(cb_record_finish(&buffer, 0, 3, 32), CB_SUCCESS);
+    
+    CbIndex slot = view.items;
+    ASSERT_EQ(cb_record_prepare(&buffer, slot, 32, &view), CB_SUCCESS);
+    memcpy(view.data[0], "defgh", 5);
+    EXPECT_EQ(cb_record_finish(&buffer, slot, 5, 32), CB_SUCCESS);
+    EXPECT_TRUE(cb_commit_write(&buffer, 2 * slot));
+    
+    // Views expose record, filler, record, filler
+    EXPECT_EQ(cb_record_view(&buffer, 0, &view), CB_SUCCESS);
+    EXPECT_FALSE(view.padding);
+    EXPECT_EQ(view.size, 3u);
+    EXPECT_EQ(cb_record_view(&buffer, view.items, &view), CB_SUCCESS);
+    EXPECT_TRUE(view.padding);
+    
+    char out[32];
+    size_t length = 0;
+    EXPECT_EQ(cb_record_read(&buffer, out, sizeof(out), &length), CB_SUCCESS);
+    EXPECT_EQ(length, 3u);
+    EXPECT_EQ(cb_record_read(&buffer, out, sizeof(out), &length), CB_SUCCESS);
+    EXPECT_EQ(length, 5u);
+    EXPECT_EQ(memcmp(out, "defgh", 5), 0);
+    EXPECT_EQ(cb_record_read(&buffer, out, sizeof(out), &length), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_dataSize(&buffer), 0);
+}
+
+// Invalid arguments
+TEST_F(RecordTest, InvalidArguments) {
+    size_t length = 0;
+    EXPECT_EQ(cb_record_write(nullptr, "x", 1), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_record_write(&buffer, nullptr, 1), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_record_read(&buffer, nullptr, 0, nullptr), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_record_peek_length(&buffer, &length), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_record_finish(&buffer, 0, 10, 5), CB_ERROR_INVALID_COUNT);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
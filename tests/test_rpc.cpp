@@ -0,0 +1,173 @@
+#include "test_common.h"
+#include "cb_rpc.h"
+#include <atomic>
+#include <string>
+#include <thread>
+
+#define RPC_RING 4096
+
+// Define RpcTest fixture
+class RpcTest : public ::testing::Test {
+protected:
+    cb requests;
+    cb responses;
+    cb_rpc_t ch;
+    CbItem request_storage[RPC_RING];
+    CbItem response_storage[RPC_RING];
+
+    void SetUp() override {
+        ASSERT_EQ(cb_init_ex(&requests, request_storage, RPC_RING), CB_SUCCESS);
+        ASSERT_EQ(cb_init_ex(&responses, response_storage, RPC_RING), CB_SUCCESS);
+        ASSERT_EQ(cb_rpc_init(&ch, &requests, &responses, 64), CB_SUCCESS);
+    }
+
+    void TearDown() override {
+        // Reset buffer statistics
+        cb_reset_stats(&requests);
+        cb_reset_stats(&responses);
+    }
+
+    // Echoes the request with a '!' appended
+    static size_t echo(const void *request, size_t length, void *response, size_t capacity, void *ctx) {
+        (void)ctx;
+        if (length + 1 > capacity) {
+            return 0;
+        }
+        memcpy(response, request, length);
+        ((char *)response)[length] = '!';
+        return length + 1;
+    }
+
+    std::string wait(uint32_t id, cb_result_t expected = CB_SUCCESS) {
+        char buf[64];
+        size_t length = 0;
+        EXPECT_EQ(cb_rpc_wait(&ch, id, buf, sizeof(buf), &length, 1000000000u), expected);
+        return std::string(buf, expected == CB_SUCCESS ? length : 0);
+    }
+};
+
+// Batched requests get responses with matching ids
+TEST_F(RpcTest, BatchSubmitAndServe) {
+    const void *data[3] = { "a", "bc", "def" };
+    const size_t lengths[3] = { 1, 2, 3 };
+    uint32_t first;
+    unsigned submitted, served;
+
+    ASSERT_EQ(cb_rpc_submit_batch(&ch, data, lengths, 3, &first, &submitted), CB_SUCCESS);
+    EXPECT_EQ(submitted, 3u);
+    EXPECT_EQ(first, 0u);
+    EXPECT_EQ(ch.next_id, 3u);
+
+    ASSERT_EQ(cb_rpc_serve(&ch, echo, NULL, 2, &served), CB_SUCCESS);
+    EXPECT_EQ(served, 2u);
+    ASSERT_EQ(cb_rpc_serve(&ch, echo, NULL, 8, &served), CB_SUCCESS);
+    EXPECT_EQ(served, 1u);
+    EXPECT_EQ(cb_rpc_serve(&ch, echo, NULL, 8, &served), CB_ERROR_BUFFER_EMPTY);
+
+    EXPECT_EQ(wait(first), "a!");
+    EXPECT_EQ(wait(first + 1), "bc!");
+    EXPECT_EQ(wait(first + 2), "def!");
+    EXPECT_EQ(ch.parks, 0u);
+}
+
+// Responses to abandoned calls are dropped; consumed ids are reported
+TEST_F(RpcTest, StaleResponses) {
+    uint32_t a, b, c;
+    unsigned served;
+    ASSERT_EQ(cb_rpc_submit(&ch, "x", 1, &a), CB_SUCCESS);
+    ASSERT_EQ(cb_rpc_submit(&ch, "y", 1, &b), CB_SUCCESS);
+    ASSERT_EQ(cb_rpc_submit(&ch, "z", 1, &c), CB_SUCCESS);
+    ASSERT_EQ(cb_rpc_serve(&ch, echo, NULL, 8, &served), CB_SUCCESS);
+
+    EXPECT_EQ(wait(b), "y!");
+    EXPECT_EQ(ch.discarded, 1u);
+    wait(a, CB_ERROR_INVALID_PARAMETER);
+    EXPECT_EQ(wait(c), "z!");
+    wait(c + 1, CB_ERROR_INVALID_PARAMETER);
+}
+
+// A response that does not fit the caller's buffer stays queued
+TEST_F(RpcTest, SmallResponseBuffer) {
+    uint32_t id;
+    unsigned served;
+    ASSERT_EQ(cb_rpc_submit(&ch, "hello", 5, &id), CB_SUCCESS);
+    ASSERT_EQ(cb_rpc_serve(&ch, echo, NULL, 1, &served), CB_SUCCESS);
+
+    char small[3];
+    size_t length;
+    EXPECT_EQ(cb_rpc_wait(&ch, id, small, sizeof(small), &length, 0), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(length, 6u);
+    EXPECT_EQ(wait(id), "hello!");
+}
+
+// A caller without a worker spins, parks, and times out
+TEST_F(RpcTest, Timeout) {
+    uint32_t id;
+    char buf[8];
+    size_t length;
+    ASSERT_EQ(cb_rpc_submit(&ch, "q", 1, &id), CB_SUCCESS);
+    EXPECT_EQ(cb_rpc_wait(&ch, id, buf, sizeof(buf), &length, 2000000u), CB_ERROR_TIMEOUT);
+    EXPECT_GE(ch.parks, 1u);
+}
+
+// The worker never takes a request it could not answer
+TEST_F(RpcTest, FullResponseRing) {
+    cb small;
+    CbItem small_storage[64];
+    ASSERT_EQ(cb_init_ex(&small, small_storage, 64), CB_SUCCESS);
+    ASSERT_EQ(cb_rpc_init(&ch, &requests, &small, 0), CB_SUCCESS);
+    EXPECT_EQ(ch.spin, (unsigned)CB_RPC_SPIN_DEFAULT);
+
+    uint32_t id;
+    unsigned served;
+    ASSERT_EQ(cb_rpc_submit(&ch, "q", 1, &id), CB_SUCCESS);
+    EXPECT_EQ(cb_rpc_serve(&ch, echo, NULL, 1, &served), CB_ERROR_BUFFER_FULL);
+    EXPECT_EQ(cb_dataSize(&requests), cb_record_items(CB_RPC_ID_SIZE + 1));
+}
+
+// Calls from one thread are answered by a worker thread, parking included
+TEST_F(RpcTest, ConcurrentCalls) {
+    std::atomic<bool> stop{false};
+    std::thread worker([&]() {
+        unsigned served;
+        while (!stop.load()) {
+            if (cb_rpc_serve(&ch, echo, NULL, 16, &served) != CB_SUCCESS) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    bool ok = true;
+    for (int i = 0; i < 2000 && ok; i++) {
+        std::string req = std::to_string(i);
+        char buf[32];
+        size_t length;
+        ok = cb_rpc_call(&ch, req.data(), req.size(), buf, sizeof(buf), &length, CB_RPC_FOREVER) == CB_SUCCESS &&
+             std::string(buf, length) == req + "!";
+    }
+    stop.store(true);
+    worker.join();
+
+    EXPECT_TRUE(ok);
+    EXPECT_EQ(ch.discarded, 0u);
+}
+
+// Invalid arguments are rejected
+TEST_F(RpcTest, Errors) {
+    uint32_t id;
+    unsigned served;
+    static char big[CB_RPC_MAX_PAYLOAD + 1];
+
+    EXPECT_EQ(cb_rpc_init(&ch, &requests, &requests, 1), CB_ERROR_INVALID_PARAMETER);
+    EXPECT_EQ(cb_rpc_init(NULL, &requests, &responses, 1), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_rpc_submit(&ch, big, sizeof(big), &id), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_rpc_submit(&ch, NULL, 1, &id), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_rpc_serve(&ch, echo, NULL, 0, &served), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_rpc_serve(&ch, NULL, NULL, 1, &served), CB_ERROR_NULL_POINTER);
+    wait(0, CB_ERROR_INVALID_PARAMETER);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,196 @@
+#include "test_common.h"
+#include "cb_soa.h"
+#include <thread>
+
+#define SOA_ROWS 64
+
+// Define SoaTest fixture: an event record split into four columns
+class SoaTest : public ::testing::Test {
+protected:
+    cb_soa_t s;
+    uint64_t ts[SOA_ROWS];
+    uint32_t id[SOA_ROWS];
+    float value[SOA_ROWS];
+    uint8_t flags[SOA_ROWS];
+
+    void SetUp() override {
+        void *const data[] = { ts, id, value, flags };
+        const size_t widths[] = { sizeof(ts[0]), sizeof(id[0]), sizeof(value[0]), sizeof(flags[0]) };
+        ASSERT_EQ(cb_soa_init(&s, SOA_ROWS, 4, data, widths), CB_SUCCESS);
+    }
+
+    void TearDown() override {
+        // Reset buffer statistics
+        cb_reset_stats(&s.ring);
+    }
+
+    void push_row(uint32_t i) {
+        uint64_t t = 1000u + i;
+        uint32_t n = i;
+        float v = (float)i * 0.5f;
+        uint8_t f = (uint8_t)(i & 0xFF);
+        const void *const fields[] = { &t, &n, &v, &f };
+        ASSERT_EQ(cb_soa_push(&s, fields), CB_SUCCESS);
+    }
+};
+
+// Rows round-trip and skipped columns are left alone
+TEST_F(SoaTest, PushPop) {
+    for (uint32_t i = 0; i < 10; i++) {
+        push_row(i);
+    }
+    EXPECT_EQ(cb_soa_count(&s), 10);
+
+    uint64_t t;
+    uint32_t n;
+    float v;
+    uint8_t f;
+    void *const all[] = { &t, &n, &v, &f };
+    ASSERT_EQ(cb_soa_pop(&s, all), CB_SUCCESS);
+    EXPECT_EQ(t, 1000u);
+    EXPECT_EQ(n, 0u);
+    EXPECT_FLOAT_EQ(v, 0.0f);
+
+    // Only the value column
+    void *const only_value[] = { NULL, NULL, &v, NULL };
+    ASSERT_EQ(cb_soa_pop(&s, only_value), CB_SUCCESS);
+    EXPECT_FLOAT_EQ(v, 0.5f);
+    EXPECT_EQ(cb_soa_count(&s), 8);
+}
+
+// Per-column reads see unit-stride data across the wrap point
+TEST_F(SoaTest, ColumnReadAndSpansWrap) {
+    uint32_t ids[SOA_ROWS];
+    float values[SOA_ROWS];
+    uint64_t stamps[SOA_ROWS];
+    uint8_t fl[SOA_ROWS];
+    for (uint32_t i = 0; i < SOA_ROWS; i++) {
+        ids[i] = i;
+        values[i] = (float)i;
+        stamps[i] = i;
+        fl[i] = 0;
+    }
+    const void *const cols[] = { stamps, ids, values, fl };
+    void *const none[] = { NULL, NULL, NULL, NULL };
+
+    // Move the indices near the end so the next batch wraps
+    CbIndex n = 0;
+    ASSERT_EQ(cb_soa_insert_bulk(&s, cols, 50, &n), CB_SUCCESS);
+    ASSERT_EQ(cb_soa_remove_bulk(&s, none, 50, &n), CB_SUCCESS);
+    ASSERT_EQ(cb_soa_insert_bulk(&s, cols, 40, &n), CB_SUCCESS);
+    ASSERT_EQ(n, 40);
+
+    float copy[40];
+    CbIndex copied = 0;
+    ASSERT_EQ(cb_soa_read_column(&s, 2, 0, copy, 40, &copied), CB_SUCCESS);
+    ASSERT_EQ(copied, 40);
+    for (int i = 0; i < 40; i++) {
+        EXPECT_FLOAT_EQ(copy[i], (float)i);
+    }
+    ASSERT_EQ(cb_soa_read_column(&s, 1, 35, ids, 40, &copied), CB_SUCCESS);
+    EXPECT_EQ(copied, 5);
+    EXPECT_EQ(ids[0], 35u);
+
+    // Spans of one column, then one commit for every column
+    cb_soa_span_t spans[2];
+    CbIndex available = 0;
+    ASSERT_EQ(cb_soa_get_read_spans(&s, 2, spans, &available), CB_SUCCESS);
+    EXPECT_EQ(available, 40);
+    EXPECT_EQ(spans[0].count, (CbIndex)(SOA_ROWS - 50));
+    EXPECT_EQ(spans[1].count, (CbIndex)(40 - (SOA_ROWS - 50)));
+    float sum = 0.0f;
+    for (int k = 0; k < 2; k++) {
+        const float *p = (const float *)spans[k].data;
+        for (CbIndex i = 0; i < spans[k].count; i++) {
+            sum += p[i];
+        }
+    }
+    EXPECT_FLOAT_EQ(sum, 39.0f * 40.0f / 2.0f);
+    ASSERT_EQ(cb_soa_commit_read(&s, available), CB_SUCCESS);
+    EXPECT_EQ(cb_soa_count(&s), 0);
+}
+
+// Writing through spans of every column and committing once publishes the rows
+TEST_F(SoaTest, WriteSpans) {
+    cb_soa_span_t spans[2];
+    CbIndex available = 0;
+
+    for (unsigned c = 0; c < 4; c++) {
+        ASSERT_EQ(cb_soa_get_write_spans(&s, c, spans, &available), CB_SUCCESS);
+        ASSERT_EQ(available, (CbIndex)(SOA_ROWS - 1));
+        memset(spans[0].data, (int)(c + 1), (size_t)3 * s.width[c]);
+    }
+    ASSERT_EQ(cb_soa_commit_write(&s, 3), CB_SUCCESS);
+
+    uint8_t f[3];
+    CbIndex copied = 0;
+    ASSERT_EQ(cb_soa_read_column(&s, 3, 0, f, 3, &copied), CB_SUCCESS);
+    EXPECT_EQ(f[2], 4);
+    EXPECT_EQ(cb_soa_commit_write(&s, SOA_ROWS), CB_ERROR_INVALID_COUNT);
+}
+
+// One producer and one consumer that reads only the id column
+TEST_F(SoaTest, ConcurrentSingleColumnConsumer) {
+    const uint32_t total = 100000;
+
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < total; i++) {
+            uint64_t t = i;
+            float v = 0.0f;
+            uint8_t f = 0;
+            const void *const fields[] = { &t, &i, &v, &f };
+            while (cb_soa_push(&s, fields) != CB_SUCCESS) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint32_t expected = 0;
+    while (expected < total) {
+        cb_soa_span_t spans[2];
+        CbIndex available = 0;
+        if (cb_soa_get_read_spans(&s, 1, spans, &available) != CB_SUCCESS) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (int k = 0; k < 2; k++) {
+            const uint32_t *p = (const uint32_t *)spans[k].data;
+            for (CbIndex i = 0; i < spans[k].count; i++) {
+                ASSERT_EQ(p[i], expected++);
+            }
+        }
+        ASSERT_EQ(cb_soa_commit_read(&s, available), CB_SUCCESS);
+    }
+
+    producer.join();
+    EXPECT_EQ(cb_soa_count(&s), 0);
+}
+
+// Invalid arguments are rejected
+TEST_F(SoaTest, Errors) {
+    cb_soa_t other;
+    void *const data[] = { id, NULL };
+    const size_t widths[] = { sizeof(id[0]), 0 };
+    CbIndex n;
+    uint32_t dst[4];
+    cb_soa_span_t spans[2];
+
+    EXPECT_EQ(cb_soa_init(&other, SOA_ROWS, 0, data, widths), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_soa_init(&other, SOA_ROWS, CB_SOA_MAX_COLUMNS + 1, data, widths), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_soa_init(&other, SOA_ROWS, 2, data, widths), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_soa_init(NULL, SOA_ROWS, 1, data, widths), CB_ERROR_NULL_POINTER);
+
+    void *const none[] = { NULL, NULL, NULL, NULL };
+    EXPECT_EQ(cb_soa_pop(&s, none), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_soa_push(&s, (const void *const *)none), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_soa_read_column(&s, 4, 0, dst, 4, &n), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_soa_read_column(&s, 0, 0, dst, 4, &n), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_soa_get_read_spans(&s, 9, spans, &n), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_soa_get_read_spans(&s, 0, spans, &n), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_soa_count(NULL), 0);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
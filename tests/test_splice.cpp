@@ -0,0 +1,157 @@
+#include "test_common.h"
+#include "cb_splice.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <vector>
+
+// Define SpliceTest fixture
+class SpliceTest : public ::testing::Test {
+protected:
+    cb_splice_t sp;
+    int pipefd[2];
+    
+    void SetUp() override {
+        ASSERT_EQ(cb_splice_create(&sp, 4096), CB_SUCCESS);
+        ASSERT_EQ(pipe(pipefd), 0);
+    }
+    
+    void TearDown() override {
+        close(pipefd[0]);
+        close(pipefd[1]);
+        cb_splice_destroy(&sp);
+    }
+    
+    void fill(CbIndex count, int seed) {
+        for (CbIndex i = 0; i < count; i++) {
+            ASSERT_TRUE(cb_insert(&sp.ring, (CbItem)(seed + i)));
+        }
+    }
+};
+
+// Storage is page aligned and rounded up to whole pages
+TEST_F(SpliceTest, PageAlignedStorage) {
+    long page = sysconf(_SC_PAGESIZE);
+    EXPECT_EQ((uintptr_t)sp.ring.buf % (uintptr_t)page, 0u);
+    EXPECT_EQ(sp.map_length % (size_t)page, 0u);
+    EXPECT_GE(sp.ring.size * sizeof(CbItem), 4096u);
+}
+
+// Exported items stay occupied until the pipe reader consumes them
+TEST_F(SpliceTest, ExportHoldsSlotsUntilReclaimed) {
+    fill(100, 0);
+    
+    size_t exported = 0;
+    ASSERT_EQ(cb_splice_export(&sp, pipefd[1], 1 << 20, &exported), CB_SUCCESS);
+    EXPECT_EQ(exported, 100 * sizeof(CbItem));
+    EXPECT_EQ(cb_dataSize(&sp.ring), 100);
+    
+    // Nothing new to export
+    EXPECT_EQ(cb_splice_export(&sp, pipefd[1], 1 << 20, &exported), CB_ERROR_BUFFER_EMPTY);
+    
+    // Unread data keeps the slots
+    CbIndex released = 0;
+    EXPECT_EQ(cb_splice_reclaim(&sp, &released), CB_SUCCESS);
+    EXPECT_EQ(released, 0);
+    
+    // Consume part of the pipe; exactly that part is released
+    std::vector<CbItem> out(100);
+    ASSERT_EQ(read(pipefd[0], out.data(), 40 * sizeof(CbItem)), (ssize_t)(40 * sizeof(CbItem)));
+    EXPECT_EQ(cb_splice_reclaim(&sp, &released), CB_SUCCESS);
+    EXPECT_EQ(released, 40);
+    EXPECT_EQ(cb_dataSize(&sp.ring), 60);
+    
+    ASSERT_EQ(read(pipefd[0], out.data() + 40, 60 * sizeof(CbItem)), (ssize_t)(60 * sizeof(CbItem)));
+    EXPECT_EQ(cb_splice_reclaim(&sp, &released), CB_SUCCESS);
+    EXPECT_EQ(released, 60);
+    EXPECT_EQ(cb_dataSize(&sp.ring), 0);
+    
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(out[i], (CbItem)i);
+    }
+}
+
+// Wrapped contents are exported in order with two iovecs
+TEST_F(SpliceTest, ExportWrapped) {
+    CbIndex capacity = sp.ring.size - 1;
+    fill(capacity - 10, 0);
+    std::vector<CbItem> drain(capacity);
+    ASSERT_EQ(cb_remove_bulk(&sp.ring, drain.data(), capacity - 10), capacity - 10);
+    fill(30, 7);
+    
+    size_t exported = 0;
+    ASSERT_EQ(cb_splice_export(&sp, pipefd[1], 1 << 20, &exported), CB_SUCCESS);
+    ASSERT_EQ(exported, 30 * sizeof(CbItem));
+    
+    std::vector<CbItem> out(30);
+    ASSERT_EQ(read(pipefd[0], out.data(), exported), (ssize_t)exported);
+    for (int i = 0; i < 30; i++) {
+        EXPECT_EQ(out[i], (CbItem)(7 + i));
+    }
+}
+
+// Explicit acknowledgement
+TEST_F(SpliceTest, ExplicitAck) {
+    fill(20, 0);
+    size_t exported = 0;
+    ASSERT_EQ(cb_splice_export(&sp, pipefd[1], 8 * sizeof(CbItem), &exported), CB_SUCCESS);
+    EXPECT_EQ(exported, 8 * sizeof(CbItem));
+    
+    // A second pipe cannot be used while bytes are in flight
+    int other[2];
+    ASSERT_EQ(pipe(other), 0);
+    EXPECT_EQ(cb_splice_export(&sp, other[1], 1 << 20, &exported), CB_ERROR_INVALID_PARAMETER);
+    close(other[0]);
+    close(other[1]);
+    
+    CbIndex released = 0;
+    EXPECT_EQ(cb_splice_ack(&sp, 9 * sizeof(CbItem), &released), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_splice_ack(&sp, 8 * sizeof(CbItem), &released), CB_SUCCESS);
+    EXPECT_EQ(released, 8);
+    EXPECT_EQ(cb_dataSize(&sp.ring), 12);
+}
+
+// Ring -> pipe -> file without user-space copies
+TEST_F(SpliceTest, SpliceToFile) {
+    char path[] = "/tmp/cb_splice_testXXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    unlink(path);
+    
+    CbIndex total = 0;
+    size_t written = 0;
+    for (int round = 0; round < 5; round++) {
+        fill(1000, round);
+        ASSERT_EQ(cb_splice_to_fd(&sp, pipefd[1], pipefd[0], fd, 1 << 20, &written), CB_SUCCESS);
+        EXPECT_EQ(written, 1000 * sizeof(CbItem));
+        total += 1000;
+    }
+    EXPECT_EQ(cb_dataSize(&sp.ring), 0);
+    
+    std::vector<CbItem> out(total);
+    ASSERT_EQ(pread(fd, out.data(), total * sizeof(CbItem), 0), (ssize_t)(total * sizeof(CbItem)));
+    for (int round = 0; round < 5; round++) {
+        for (int i = 0; i < 1000; i++) {
+            EXPECT_EQ(out[round * 1000 + i], (CbItem)(round + i));
+        }
+    }
+    close(fd);
+}
+
+// Invalid arguments
+TEST_F(SpliceTest, InvalidArguments) {
+    size_t exported = 0;
+    CbIndex released = 0;
+    EXPECT_EQ(cb_splice_create(nullptr, 4096), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_splice_export(&sp, pipefd[1], 1 << 20, nullptr), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_splice_export(&sp, pipefd[1], 0, &exported), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_splice_export(&sp, pipefd[1], 1 << 20, &exported), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(cb_splice_reclaim(nullptr, &released), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_splice_pipe_to_fd(-1, 1, 10, &exported), CB_ERROR_INVALID_PARAMETER);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,88 @@
+#include "test_common.h"
+#include "cb_stream.h"
+#include <vector>
+
+#define STREAM_RING 4099
+
+// Define StreamTest fixture
+class StreamTest : public ::testing::Test {
+protected:
+    cb ring;
+    CbItem storage[STREAM_RING];
+
+    void SetUp() override {
+        ASSERT_EQ(cb_init_ex(&ring, storage, STREAM_RING), CB_SUCCESS);
+    }
+
+    void TearDown() override {
+        // Reset buffer statistics
+        cb_reset_stats(&ring);
+    }
+
+    void check_drain(CbItem first, CbIndex count) {
+        CbItem item;
+        for (CbIndex i = 0; i < count; i++) {
+            ASSERT_TRUE(cb_remove(&ring, &item));
+            ASSERT_EQ(item, (CbItem)(first + i)) << "i=" << i;
+        }
+    }
+};
+
+// Every mode stores the same items, across odd offsets and the wrap
+TEST_F(StreamTest, ModesAgree) {
+    const cb_stream_mode_t modes[] = { CB_STREAM_AUTO, CB_STREAM_CACHED, CB_STREAM_NONTEMPORAL };
+    std::vector<CbItem> items(3000);
+    for (size_t i = 0; i < items.size(); i++) {
+        items[i] = (CbItem)(i * 7 + 3);
+    }
+
+    for (int round = 0; round < 30; round++) {
+        CbIndex count = (CbIndex)(1 + (round * 397) % 2999);
+        CbIndex inserted;
+        ASSERT_EQ(cb_stream_insert_bulk(&ring, items.data(), count, modes[round % 3], &inserted), CB_SUCCESS);
+        ASSERT_EQ(inserted, count);
+        CbItem item;
+        for (CbIndex i = 0; i < count; i++) {
+            ASSERT_TRUE(cb_remove(&ring, &item));
+            ASSERT_EQ(item, items[i]) << "round=" << round << " i=" << i;
+        }
+    }
+}
+
+// Partial inserts stop at the free space; a full ring reports full
+TEST_F(StreamTest, PartialAndFull) {
+    std::vector<CbItem> items(STREAM_RING * 2);
+    for (size_t i = 0; i < items.size(); i++) {
+        items[i] = (CbItem)i;
+    }
+
+    CbIndex inserted;
+    ASSERT_EQ(cb_stream_insert_bulk(&ring, items.data(), 100, CB_STREAM_CACHED, &inserted), CB_SUCCESS);
+    check_drain(0, 100);
+
+    ASSERT_EQ(cb_stream_insert_bulk(&ring, items.data(), (CbIndex)items.size(), CB_STREAM_NONTEMPORAL, &inserted),
+              CB_SUCCESS);
+    EXPECT_EQ(inserted, (CbIndex)(STREAM_RING - 1));
+    EXPECT_EQ(cb_stream_insert_bulk(&ring, items.data(), 1, CB_STREAM_NONTEMPORAL, &inserted), CB_ERROR_BUFFER_FULL);
+    EXPECT_EQ(inserted, 0u);
+    check_drain(0, STREAM_RING - 1);
+}
+
+// Invalid arguments are rejected
+TEST_F(StreamTest, Errors) {
+    CbItem item = 0;
+    CbIndex inserted;
+
+    EXPECT_EQ(cb_stream_insert_bulk(&ring, &item, 0, CB_STREAM_AUTO, &inserted), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_stream_insert_bulk(NULL, &item, 1, CB_STREAM_AUTO, &inserted), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_stream_insert_bulk(&ring, NULL, 1, CB_STREAM_AUTO, &inserted), CB_ERROR_NULL_POINTER);
+
+#if defined(__GNUC__) && defined(__x86_64__)
+    EXPECT_TRUE(cb_stream_supported());
+#endif
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,170 @@
+#include "test_common.h"
+#include "cb_time.h"
+#include <vector>
+
+#define TIME_RING 256
+#define TIME_HORIZON 1000
+
+// Define TimeTest fixture
+class TimeTest : public ::testing::Test {
+protected:
+    cb ring;
+    cb_time_t tw;
+    CbItem storage[TIME_RING];
+    uint64_t stamps[TIME_RING];
+
+    void SetUp() override {
+        ASSERT_EQ(cb_init_ex(&ring, storage, TIME_RING), CB_SUCCESS);
+        ASSERT_EQ(cb_time_init(&tw, &ring, stamps, TIME_RING, TIME_HORIZON), CB_SUCCESS);
+    }
+
+    void TearDown() override {
+        // Reset buffer statistics
+        cb_reset_stats(&ring);
+    }
+
+    // Every stored item must be younger than the horizon at `now`
+    void check_window(uint64_t now) {
+        CbItem item;
+        uint64_t stamp, prev = 0;
+        for (CbIndex i = 0; i < cb_dataSize(&ring); i++) {
+            ASSERT_EQ(cb_time_peek(&tw, i, &item, &stamp), CB_SUCCESS);
+            ASSERT_LT(now - stamp, (uint64_t)TIME_HORIZON) << "i=" << i;
+            ASSERT_GE(stamp, prev);
+            ASSERT_EQ(item, (CbItem)stamp);
+            prev = stamp;
+        }
+    }
+};
+
+// Expiry drops exactly the items at or past the horizon
+TEST_F(TimeTest, ExpireDropsOldItems) {
+    for (uint64_t ts = 0; ts < 200; ts++) {
+        ASSERT_EQ(cb_time_insert(&tw, (CbItem)(ts * 10), ts * 10), CB_SUCCESS);
+    }
+    ASSERT_EQ(cb_dataSize(&ring), 200u);
+
+    CbIndex expired;
+    ASSERT_EQ(cb_time_expire(&tw, 1990, &expired), CB_SUCCESS);
+    EXPECT_EQ(expired, 100u);
+    ASSERT_EQ(cb_time_expire(&tw, 1990, &expired), CB_SUCCESS);
+    EXPECT_EQ(expired, 0u);
+
+    ASSERT_EQ(cb_time_expire(&tw, 2500, &expired), CB_SUCCESS);
+    EXPECT_EQ(expired, 51u);
+    EXPECT_EQ(cb_dataSize(&ring), 49u);
+
+    CbItem item;
+    uint64_t stamp;
+    ASSERT_EQ(cb_time_remove(&tw, &item, &stamp), CB_SUCCESS);
+    EXPECT_EQ(stamp, 1510u);
+
+    ASSERT_EQ(cb_time_expire(&tw, 10000, &expired), CB_SUCCESS);
+    EXPECT_EQ(expired, 48u);
+    EXPECT_EQ(cb_dataSize(&ring), 0u);
+    EXPECT_EQ(cb_time_remove(&tw, &item, &stamp), CB_ERROR_BUFFER_EMPTY);
+}
+
+// Expiry keeps the window exact across the wrap
+TEST_F(TimeTest, ExpireAcrossWrap) {
+    uint64_t now = 0;
+    CbItem item;
+    cb_set_overwrite(&ring, true);
+    for (int round = 0; round < 50; round++) {
+        for (int i = 0; i < 37; i++) {
+            now += 3 + (uint64_t)(round % 5) * 11;
+            ASSERT_EQ(cb_time_insert(&tw, (CbItem)now, now), CB_SUCCESS);
+        }
+        ASSERT_EQ(cb_time_expire(&tw, now, NULL), CB_SUCCESS);
+        check_window(now);
+        if (round % 3 == 0) {
+            cb_remove(&ring, &item);
+        }
+    }
+}
+
+// Bulk insert stamps every slot it fills
+TEST_F(TimeTest, BulkInsert) {
+    std::vector<CbItem> items(300);
+    std::vector<uint64_t> ts(300);
+    for (size_t i = 0; i < items.size(); i++) {
+        ts[i] = 100 + i * 2;
+        items[i] = (CbItem)ts[i];
+    }
+
+    CbIndex inserted;
+    ASSERT_EQ(cb_time_insert_bulk(&tw, items.data(), ts.data(), 100, &inserted), CB_SUCCESS);
+    EXPECT_EQ(inserted, 100u);
+    ASSERT_EQ(cb_time_expire(&tw, ts[99], NULL), CB_SUCCESS);
+    check_window(ts[99]);
+
+    // Without overwrite the batch stops at the free space
+    ASSERT_EQ(cb_time_insert_bulk(&tw, items.data() + 100, ts.data() + 100, 200, &inserted), CB_SUCCESS);
+    EXPECT_EQ(inserted, (CbIndex)(TIME_RING - 1 - 100));
+    ASSERT_EQ(cb_time_expire(&tw, ts[99 + inserted], NULL), CB_SUCCESS);
+    check_window(ts[99 + inserted]);
+
+    // With overwrite the batch itself spans more than the horizon
+    cb_set_overwrite(&ring, true);
+    for (size_t i = 0; i < items.size(); i++) {
+        ts[i] = 2000 + i * 4;
+        items[i] = (CbItem)ts[i];
+    }
+    ASSERT_EQ(cb_time_insert_bulk(&tw, items.data(), ts.data(), 300, &inserted), CB_SUCCESS);
+    EXPECT_EQ(inserted, 300u);
+    ASSERT_EQ(cb_time_expire(&tw, ts[299], NULL), CB_SUCCESS);
+    check_window(ts[299]);
+    EXPECT_EQ(cb_dataSize(&ring), 250u);
+}
+
+// Inserts never move `out`: a full ring waits for the consumer to expire
+TEST_F(TimeTest, InsertLeavesExpiryToConsumer) {
+    for (uint64_t ts = 0; ts < TIME_RING - 1; ts++) {
+        ASSERT_EQ(cb_time_insert(&tw, (CbItem)ts, ts), CB_SUCCESS);
+    }
+    EXPECT_EQ(cb_time_insert(&tw, (CbItem)5000, 5000), CB_ERROR_BUFFER_FULL);
+    EXPECT_EQ(cb_dataSize(&ring), (CbIndex)(TIME_RING - 1));
+
+    CbIndex expired;
+    ASSERT_EQ(cb_time_expire(&tw, 5000, &expired), CB_SUCCESS);
+    EXPECT_EQ(expired, (CbIndex)(TIME_RING - 1));
+    ASSERT_EQ(cb_time_insert(&tw, (CbItem)5000, 5000), CB_SUCCESS);
+    check_window(5000);
+}
+
+// Consumers on the plain cb API only see live items
+TEST_F(TimeTest, PlainConsumerSeesLiveItems) {
+    for (uint64_t ts = 0; ts < 50; ts++) {
+        ASSERT_EQ(cb_time_insert(&tw, (CbItem)ts, ts * 100), CB_SUCCESS);
+    }
+    ASSERT_EQ(cb_time_expire(&tw, 5000, NULL), CB_SUCCESS);
+
+    CbItem item;
+    ASSERT_TRUE(cb_remove(&ring, &item));
+    EXPECT_EQ(item, 41);
+    EXPECT_EQ(cb_dataSize(&ring), 8u);
+}
+
+// Invalid arguments are rejected
+TEST_F(TimeTest, Errors) {
+    cb_time_t other;
+    CbItem item;
+    CbIndex inserted;
+    const CbItem items[2] = { 1, 2 };
+    const uint64_t ts[2] = { 20, 10 };
+
+    EXPECT_EQ(cb_time_init(&other, &ring, stamps, TIME_RING - 1, 10), CB_ERROR_INVALID_SIZE);
+    EXPECT_EQ(cb_time_init(NULL, &ring, stamps, TIME_RING, 10), CB_ERROR_NULL_POINTER);
+
+    ASSERT_EQ(cb_time_insert(&tw, 1, 50), CB_SUCCESS);
+    EXPECT_EQ(cb_time_insert(&tw, 1, 49), CB_ERROR_INVALID_PARAMETER);
+    EXPECT_EQ(cb_time_insert_bulk(&tw, items, ts, 2, &inserted), CB_ERROR_INVALID_PARAMETER);
+    EXPECT_EQ(cb_time_insert_bulk(&tw, items, ts, 0, &inserted), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_time_peek(&tw, 1, &item, NULL), CB_ERROR_INVALID_OFFSET);
+    EXPECT_EQ(cb_dataSize(&ring), 1u);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,181 @@
+#include "test_common.h"
+#include "cb_transfer.h"
+#include <limits>
+#include <vector>
+
+#define TRANSFER_SRC 100
+#define TRANSFER_DST 64
+
+// Define TransferTest fixture
+class TransferTest : public ::testing::Test {
+protected:
+    cb src;
+    cb dst;
+    CbItem src_storage[TRANSFER_SRC];
+    CbItem dst_storage[TRANSFER_DST];
+
+    void SetUp() override {
+        ASSERT_EQ(cb_init_ex(&src, src_storage, TRANSFER_SRC), CB_SUCCESS);
+        ASSERT_EQ(cb_init_ex(&dst, dst_storage, TRANSFER_DST), CB_SUCCESS);
+    }
+
+    void TearDown() override {
+        // Reset buffer statistics
+        cb_reset_stats(&src);
+        cb_reset_stats(&dst);
+    }
+
+    void fill(CbItem first, CbIndex count) {
+        for (CbIndex i = 0; i < count; i++) {
+            ASSERT_TRUE(cb_insert(&src, (CbItem)(first + i)));
+        }
+    }
+
+    std::vector<CbItem> drain(cb *ring) {
+        std::vector<CbItem> v;
+        CbItem item;
+        while (cb_remove(ring, &item)) {
+            v.push_back(item);
+        }
+        return v;
+    }
+};
+
+// Keep even items only
+static CbIndex keep_even(const CbItem *src, CbItem *dst, CbIndex count, void *ctx) {
+    CbIndex written = 0;
+    for (CbIndex i = 0; i < count; i++) {
+        if (src[i] % 2 == 0) {
+            dst[written++] = src[i];
+        }
+    }
+    (*(int *)ctx)++;
+    return written;
+}
+
+// Plain copy across both wraps, limited by destination space and max
+TEST_F(TransferTest, CopyAcrossWraps) {
+    CbItem next_in = 0, next_out = 0;
+    CbIndex moved;
+
+    for (int round = 0; round < 60; round++) {
+        CbIndex n = (CbIndex)(7 + round * 13 % 50);
+        if (n > cb_freeSpace(&src)) {
+            n = cb_freeSpace(&src);
+        }
+        fill(next_in, n);
+        next_in = (CbItem)(next_in + n);
+
+        CbIndex before = cb_dataSize(&src);
+        CbIndex space = cb_freeSpace(&dst);
+        CbIndex max = (CbIndex)(10 + round % 40);
+        ASSERT_EQ(cb_transfer(&dst, &src, max, NULL, NULL, &moved), CB_SUCCESS);
+        EXPECT_EQ(moved, std::min(std::min(before, space), max));
+
+        // Drain part of the destination so its indices wrap too
+        CbItem item;
+        for (int i = 0; i < 20 && cb_remove(&dst, &item); i++) {
+            ASSERT_EQ(item, next_out);
+            next_out++;
+        }
+    }
+    for (CbItem item : drain(&dst)) {
+        ASSERT_EQ(item, next_out);
+        next_out++;
+    }
+}
+
+// A filtering callback writes fewer items than it reads
+TEST_F(TransferTest, FilterCallback) {
+    int calls = 0;
+    CbIndex moved;
+
+    // Put the source indices near the end of the storage
+    fill(0, 90);
+    drain(&src);
+    fill(0, 80);
+
+    ASSERT_EQ(cb_transfer(&dst, &src, 80, keep_even, &calls, &moved), CB_SUCCESS);
+    EXPECT_EQ(moved, 80u);
+    EXPECT_GE(calls, 2);
+
+    std::vector<CbItem> out = drain(&dst);
+    ASSERT_EQ(out.size(), 40u);
+    for (size_t i = 0; i < out.size(); i++) {
+        EXPECT_EQ(out[i], (CbItem)(2 * i));
+    }
+    EXPECT_EQ(cb_dataSize(&src), 0u);
+}
+
+// Built-in transforms
+TEST_F(TransferTest, BuiltIns) {
+    CbIndex moved;
+
+    fill(10, 30);
+    float factor = 2.0f;
+    ASSERT_EQ(cb_transfer(&dst, &src, 30, cb_transfer_scale, &factor, &moved), CB_SUCCESS);
+    std::vector<CbItem> out = drain(&dst);
+    ASSERT_EQ(out.size(), 30u);
+    for (size_t i = 0; i < out.size(); i++) {
+        EXPECT_EQ(out[i], (CbItem)((10 + i) * 2));
+    }
+
+    CbItem a[3] = { 1, 2, 3 };
+    CbItem b[3];
+    EXPECT_EQ(cb_transfer_bswap(a, b, 3, NULL), 3u);
+    for (int i = 0; i < 3; i++) {
+        CbItem expected;
+        const uint8_t *s = (const uint8_t *)&a[i];
+        uint8_t *d = (uint8_t *)&expected;
+        for (size_t k = 0; k < sizeof(CbItem); k++) {
+            d[k] = s[sizeof(CbItem) - 1 - k];
+        }
+        EXPECT_EQ(b[i], expected);
+    }
+}
+
+// Scaled values outside the item range saturate instead of wrapping
+TEST_F(TransferTest, ScaleSaturates) {
+    const CbItem lowest = std::numeric_limits<CbItem>::lowest();
+    const CbItem highest = std::numeric_limits<CbItem>::max();
+    CbItem in[3] = { 0, 1, 100 };
+    CbItem out[3];
+
+    float factor = 1e30f;
+    EXPECT_EQ(cb_transfer_scale(in, out, 3, &factor), 3u);
+    EXPECT_EQ(out[0], (CbItem)0);
+    EXPECT_EQ(out[1], highest);
+    EXPECT_EQ(out[2], highest);
+
+    factor = -1e30f;
+    EXPECT_EQ(cb_transfer_scale(in, out, 3, &factor), 3u);
+    EXPECT_EQ(out[0], (CbItem)0);
+    EXPECT_EQ(out[1], lowest);
+    EXPECT_EQ(out[2], lowest);
+
+    factor = std::numeric_limits<float>::quiet_NaN();
+    EXPECT_EQ(cb_transfer_scale(in, out, 3, &factor), 3u);
+    EXPECT_EQ(out[1], lowest);
+}
+
+// Invalid arguments and empty/full rings
+TEST_F(TransferTest, Errors) {
+    CbIndex moved;
+
+    EXPECT_EQ(cb_transfer(&dst, &src, 10, NULL, NULL, &moved), CB_ERROR_BUFFER_EMPTY);
+    fill(0, 10);
+    EXPECT_EQ(cb_transfer(&dst, &src, 0, NULL, NULL, &moved), CB_ERROR_INVALID_COUNT);
+    EXPECT_EQ(cb_transfer(&src, &src, 10, NULL, NULL, &moved), CB_ERROR_INVALID_PARAMETER);
+    EXPECT_EQ(cb_transfer(NULL, &src, 10, NULL, NULL, &moved), CB_ERROR_NULL_POINTER);
+
+    for (int i = 0; i < TRANSFER_DST - 1; i++) {
+        cb_insert(&dst, 0);
+    }
+    EXPECT_EQ(cb_transfer(&dst, &src, 10, NULL, NULL, &moved), CB_ERROR_BUFFER_FULL);
+    EXPECT_EQ(cb_dataSize(&src), 10u);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,104 @@
+#include "test_common.h"
+#include "cb_wait.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#define WAIT_RING 256
+
+// Define WaitTest fixture
+class WaitTest : public ::testing::TestWithParam<cb_wait_mode_t> {
+protected:
+    cb ring;
+    cb_wait_t w;
+    CbItem storage[WAIT_RING];
+
+    void SetUp() override {
+        ASSERT_EQ(cb_init_ex(&ring, storage, WAIT_RING), CB_SUCCESS);
+        ASSERT_EQ(cb_wait_init(&w, &ring, GetParam()), CB_SUCCESS);
+    }
+
+    void TearDown() override {
+        // Reset buffer statistics
+        cb_reset_stats(&ring);
+    }
+};
+
+// Items already present are returned without sleeping; no waiter means no wake
+TEST_P(WaitTest, FastPath) {
+    ASSERT_EQ(cb_wait_insert(&w, 5), CB_SUCCESS);
+    CbItem items[3] = { 6, 7, 8 };
+    CbIndex inserted;
+    ASSERT_EQ(cb_wait_insert_bulk(&w, items, 3, &inserted), CB_SUCCESS);
+    EXPECT_EQ(inserted, 3u);
+
+    CbItem item;
+    for (int i = 5; i <= 8; i++) {
+        ASSERT_EQ(cb_wait_remove(&w, &item, 100), CB_SUCCESS);
+        EXPECT_EQ(item, i);
+    }
+    EXPECT_EQ(cb_wait_remove(&w, &item, CB_NO_WAIT), CB_ERROR_BUFFER_EMPTY);
+    EXPECT_EQ(w.sleeps, 0u);
+    EXPECT_EQ(w.wakes, 0u);
+}
+
+// An empty ring times out after sleeping
+TEST_P(WaitTest, Timeout) {
+    CbItem item;
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(cb_wait_remove(&w, &item, 20), CB_ERROR_TIMEOUT);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+    EXPECT_GE(w.sleeps, 1u);
+}
+
+// A sleeping consumer is woken by the producer; nothing is lost
+TEST_P(WaitTest, ProducerWakesConsumer) {
+    const int total = 50000;
+    std::thread producer([&]() {
+        for (int i = 0; i < total;) {
+            if (cb_wait_insert(&w, (CbItem)i) == CB_SUCCESS) {
+                i++;
+                if (i % 5000 == 0) {
+                    // Let the consumer drain and fall asleep
+                    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                }
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    bool ordered = true;
+    CbItem item;
+    for (int i = 0; i < total; i++) {
+        ASSERT_EQ(cb_wait_remove(&w, &item, 5000), CB_SUCCESS);
+        ordered = ordered && item == (CbItem)i;
+    }
+    producer.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_GE(w.wakes, 1u);
+    EXPECT_LE(w.wakes, w.sleeps + 1);
+}
+
+INSTANTIATE_TEST_SUITE_P(Modes, WaitTest, ::testing::Values(CB_WAIT_SYMMETRIC, CB_WAIT_ASYMMETRIC));
+
+// Invalid arguments are rejected; the mode in use is reported
+TEST(WaitInit, Errors) {
+    cb ring;
+    CbItem storage[8];
+    cb_wait_t w;
+
+    ASSERT_EQ(cb_init_ex(&ring, storage, 8), CB_SUCCESS);
+    EXPECT_EQ(cb_wait_init(&w, NULL, CB_WAIT_SYMMETRIC), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_wait_init(&w, &ring, (cb_wait_mode_t)7), CB_ERROR_INVALID_PARAMETER);
+    ASSERT_EQ(cb_wait_init(&w, &ring, CB_WAIT_ASYMMETRIC), CB_SUCCESS);
+    EXPECT_TRUE(w.mode == CB_WAIT_ASYMMETRIC || w.mode == CB_WAIT_SYMMETRIC);
+    EXPECT_EQ(cb_wait_remove(&w, NULL, 0), CB_ERROR_NULL_POINTER);
+    EXPECT_EQ(cb_wait_insert(NULL, 1), CB_ERROR_NULL_POINTER);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}